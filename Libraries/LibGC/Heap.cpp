@@ -47,8 +47,18 @@ Heap::~Heap()
     collect_garbage(CollectionType::CollectEverything);
 }
 
+static thread_local bool s_allocation_is_forbidden_on_current_thread = false;
+
+void Heap::set_allocation_is_forbidden_on_current_thread(bool forbidden)
+{
+    s_allocation_is_forbidden_on_current_thread = forbidden;
+}
+
 void Heap::will_allocate(size_t size)
 {
+    if constexpr (HEAP_DEBUG)
+        VERIFY(!s_allocation_is_forbidden_on_current_thread);
+
     if (should_collect_on_every_allocation()) {
         m_allocated_bytes_since_last_gc = 0;
         collect_garbage();
@@ -76,6 +76,10 @@ public:
 
     bool is_gc_deferred() const { return m_gc_deferrals > 0; }
 
+    // Threads that run alongside the heap's own thread (for example, layout worker threads) must never allocate
+    // cells. They set this so that, with HEAP_DEBUG, an accidental allocation fails loudly instead of corrupting the heap.
+    static void set_allocation_is_forbidden_on_current_thread(bool);
+
     void enqueue_post_gc_task(AK::Function<void()>);
 
 private:
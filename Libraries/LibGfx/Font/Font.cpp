@@ -4,12 +4,19 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <harfbuzz/hb.h>
 
 namespace Gfx {
 
+Font::Font()
+{
+    static Atomic<u64> s_next_unique_id { 1 };
+    m_unique_id = s_next_unique_id.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+}
+
 Font::~Font()
 {
     if (m_harfbuzz_font)
@@ -7,7 +7,7 @@
 
 #pragma once
 
-#include <AK/RefCounted.h>
+#include <AK/AtomicRefCounted.h>
 #include <AK/RefPtr.h>
 #include <AK/String.h>
 #include <AK/Types.h>
@@ -50,7 +50,7 @@ constexpr float text_shaping_resolution = 64;
 
 class Typeface;
 
-class Font : public RefCounted<Font> {
+class Font : public AtomicRefCounted<Font> {
 public:
     virtual ~Font();
 
@@ -89,7 +89,15 @@ public:
 
     virtual Typeface const& typeface() const = 0;
 
+    // Unique for the lifetime of the process, unlike the font's address. Lets caches refer to a font without
+    // keeping it alive.
+    u64 unique_id() const { return m_unique_id; }
+
+protected:
+    Font();
+
 private:
+    u64 m_unique_id { 0 };
     mutable RefPtr<Gfx::Font const> m_bold_variant;
     mutable hb_font_t* m_harfbuzz_font { nullptr };
 };
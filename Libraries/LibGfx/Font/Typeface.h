@@ -6,8 +6,8 @@
 
 #pragma once
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/HashMap.h>
-#include <AK/RefCounted.h>
 #include <LibGfx/Font/FontData.h>
 #include <LibGfx/Forward.h>
 
@@ -34,7 +34,7 @@ struct ScaledFontMetrics {
     }
 };
 
-class Typeface : public RefCounted<Typeface> {
+class Typeface : public AtomicRefCounted<Typeface> {
 public:
     static ErrorOr<NonnullRefPtr<Typeface>> try_load_from_resource(Core::Resource const&, int ttc_index = 0);
     static ErrorOr<NonnullRefPtr<Typeface>> try_load_from_font_data(NonnullOwnPtr<Gfx::FontData>, int ttc_index = 0);
@@ -6,13 +6,17 @@
  */
 
 #include "TextLayout.h"
+#include <AK/BitCast.h>
+#include <AK/ByteString.h>
+#include <AK/HashFunctions.h>
+#include <AK/OrderedHashMap.h>
 #include <AK/TypeCasts.h>
 #include <LibGfx/Point.h>
 #include <harfbuzz/hb.h>
 
 namespace Gfx {
 
-RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf8View string, Gfx::Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+static NonnullRefPtr<GlyphRun> shape_text_without_cache(FloatPoint baseline_start, float letter_spacing, Utf8View string, Gfx::Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
 {
     hb_buffer_t* buffer = hb_buffer_create();
     ScopeGuard destroy_buffer = [&]() { hb_buffer_destroy(buffer); };
@@ -65,6 +69,96 @@ RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf
     return adopt_ref(*new Gfx::GlyphRun(move(glyph_run), font, text_type, point.x()));
 }
 
+// Text shorter than this is cached, which covers the word-sized chunks that inline layout shapes.
+static constexpr size_t max_cached_shaped_text_length = 256;
+static constexpr size_t max_cached_shaped_text_runs = 4096;
+
+struct CachedShapedText {
+    ByteString text;
+    u64 font_id { 0 };
+    float letter_spacing { 0 };
+    ShapeFeatures features;
+
+    // Glyph positions relative to a baseline start of (0, 0).
+    Vector<DrawGlyph> glyphs;
+    float width { 0 };
+};
+
+static bool features_are_equal(ShapeFeatures const& a, ShapeFeatures const& b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (__builtin_memcmp(a[i].tag, b[i].tag, sizeof(a[i].tag)) != 0 || a[i].value != b[i].value)
+            return false;
+    }
+    return true;
+}
+
+static u32 shaped_text_cache_key(StringView text, Font const& font, float letter_spacing, ShapeFeatures const& features)
+{
+    auto hash = pair_int_hash(text.hash(), u64_hash(font.unique_id()));
+    hash = pair_int_hash(hash, bit_cast<u32>(letter_spacing));
+    for (auto const& feature : features)
+        hash = pair_int_hash(hash, pair_int_hash(HB_TAG(feature.tag[0], feature.tag[1], feature.tag[2], feature.tag[3]), feature.value));
+    return hash;
+}
+
+// NOTE: Relayout shapes the same words over and over again, so we keep the most recently shaped runs around.
+//       The cache is per thread so that lookups don't need a lock. Entries refer to fonts by their unique ID
+//       rather than keeping them alive, so unloading a (web) font doesn't wait for its entries to be evicted.
+static OrderedHashMap<u32, CachedShapedText>& shaped_text_cache()
+{
+    static thread_local OrderedHashMap<u32, CachedShapedText> cache;
+    return cache;
+}
+
+RefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spacing, Utf8View string, Gfx::Font const& font, GlyphRun::TextType text_type, ShapeFeatures const& features)
+{
+    auto text = string.as_string();
+    if (text.length() > max_cached_shaped_text_length)
+        return shape_text_without_cache(baseline_start, letter_spacing, string, font, text_type, features);
+
+    auto& cache = shaped_text_cache();
+    auto key = shaped_text_cache_key(text, font, letter_spacing, features);
+
+    auto create_glyph_run = [&](CachedShapedText const& entry) {
+        Vector<DrawGlyph> glyphs;
+        glyphs.ensure_capacity(entry.glyphs.size());
+        for (auto glyph : entry.glyphs) {
+            glyph.translate_by(baseline_start);
+            glyphs.unchecked_append(glyph);
+        }
+        return adopt_ref(*new Gfx::GlyphRun(move(glyphs), font, text_type, baseline_start.x() + entry.width));
+    };
+
+    if (auto it = cache.find(key); it != cache.end()) {
+        auto entry = move(it->value);
+        cache.remove(it);
+        if (entry.font_id == font.unique_id() && entry.letter_spacing == letter_spacing && entry.text == text && features_are_equal(entry.features, features)) {
+            auto glyph_run = create_glyph_run(entry);
+            cache.set(key, move(entry));
+            return glyph_run;
+        }
+    }
+
+    auto shaped_text = shape_text_without_cache({}, letter_spacing, string, font, text_type, features);
+    CachedShapedText entry {
+        .text = text.to_byte_string(),
+        .font_id = font.unique_id(),
+        .letter_spacing = letter_spacing,
+        .features = features,
+        .glyphs = shaped_text->glyphs(),
+        .width = shaped_text->width(),
+    };
+    auto glyph_run = create_glyph_run(entry);
+
+    if (cache.size() >= max_cached_shaped_text_runs)
+        cache.remove(cache.begin());
+    cache.set(key, move(entry));
+    return glyph_run;
+}
+
 float measure_text_width(Utf8View const& string, Gfx::Font const& font, ShapeFeatures const& features)
 {
     auto glyph_run = shape_text({}, 0, string, font, GlyphRun::TextType::Common, features);
@@ -1784,6 +1784,7 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> CallExpression::generat
                 this_value,
                 argument_operands,
                 builtin.value(),
+                generator.next_call_site_cache(),
                 expression_string_index);
         } else if (call_type == Op::CallType::Construct) {
             generator.emit_with_extra_operand_slots<Bytecode::Op::CallConstruct>(
@@ -1808,6 +1809,7 @@ Bytecode::CodeGenerationErrorOr<Optional<ScopedOperand>> CallExpression::generat
                 callee,
                 this_value,
                 argument_operands,
+                generator.next_call_site_cache(),
                 expression_string_index);
         }
     }
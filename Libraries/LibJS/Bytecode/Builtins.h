@@ -12,15 +12,29 @@
 namespace JS::Bytecode {
 
 // TitleCaseName, snake_case_name, base, property, argument_count
-#define JS_ENUMERATE_BUILTINS(O)             \
-    O(MathAbs, math_abs, Math, abs, 1)       \
-    O(MathLog, math_log, Math, log, 1)       \
-    O(MathPow, math_pow, Math, pow, 2)       \
-    O(MathExp, math_exp, Math, exp, 1)       \
-    O(MathCeil, math_ceil, Math, ceil, 1)    \
-    O(MathFloor, math_floor, Math, floor, 1) \
-    O(MathRound, math_round, Math, round, 1) \
-    O(MathSqrt, math_sqrt, Math, sqrt, 1)
+#define JS_ENUMERATE_STATIC_BUILTINS(O)                 \
+    O(MathAbs, math_abs, Math, abs, 1)                  \
+    O(MathLog, math_log, Math, log, 1)                  \
+    O(MathPow, math_pow, Math, pow, 2)                  \
+    O(MathExp, math_exp, Math, exp, 1)                  \
+    O(MathCeil, math_ceil, Math, ceil, 1)               \
+    O(MathFloor, math_floor, Math, floor, 1)            \
+    O(MathRound, math_round, Math, round, 1)            \
+    O(MathSqrt, math_sqrt, Math, sqrt, 1)               \
+    O(MathMin, math_min, Math, min, 2)                  \
+    O(MathMax, math_max, Math, max, 2)                  \
+    O(ObjectHasOwn, object_has_own, Object, hasOwn, 2)  \
+    O(ArrayIsArray, array_is_array, Array, isArray, 1)
+
+// These are called as methods on an arbitrary receiver, so only the property name is matched at the call site.
+// TitleCaseName, snake_case_name, base, property, argument_count
+#define JS_ENUMERATE_PROTOTYPE_BUILTINS(O)                                                      \
+    O(StringPrototypeCharCodeAt, string_prototype_char_code_at, String.prototype, charCodeAt, 1) \
+    O(ArrayPrototypePush, array_prototype_push, Array.prototype, push, 1)
+
+#define JS_ENUMERATE_BUILTINS(O)     \
+    JS_ENUMERATE_STATIC_BUILTINS(O) \
+    JS_ENUMERATE_PROTOTYPE_BUILTINS(O)
 
 enum class Builtin : u8 {
 #define DEFINE_BUILTIN_ENUM(name, ...) name,
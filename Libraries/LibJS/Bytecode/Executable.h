@@ -34,6 +34,10 @@ struct GlobalVariableCache : public PropertyLookupCache {
     Optional<u32> environment_binding_index;
 };
 
+struct CallSiteCache {
+    WeakPtr<ECMAScriptFunctionObject> callee;
+};
+
 struct SourceRecord {
     u32 source_start_offset {};
     u32 source_end_offset {};
@@ -53,6 +57,7 @@ public:
         NonnullRefPtr<SourceCode const>,
         size_t number_of_property_lookup_caches,
         size_t number_of_global_variable_caches,
+        size_t number_of_call_site_caches,
         size_t number_of_registers,
         bool is_strict_mode);
 
@@ -62,6 +67,7 @@ public:
     Vector<u8> bytecode;
     Vector<PropertyLookupCache> property_lookup_caches;
     Vector<GlobalVariableCache> global_variable_caches;
+    Vector<CallSiteCache> call_site_caches;
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
     NonnullOwnPtr<RegexTable> regex_table;
@@ -27,10 +27,12 @@
 #include <LibJS/Runtime/Iterator.h>
 #include <LibJS/Runtime/MathObject.h>
 #include <LibJS/Runtime/NativeFunction.h>
+#include <LibJS/Runtime/ObjectConstructor.h>
 #include <LibJS/Runtime/ObjectEnvironment.h>
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/Reference.h>
 #include <LibJS/Runtime/RegExpObject.h>
+#include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
@@ -2543,7 +2545,7 @@ void GetImportMeta::execute_impl(Bytecode::Interpreter& interpreter) const
     interpreter.set(dst(), interpreter.vm().get_import_meta());
 }
 
-static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& interpreter, Bytecode::Builtin builtin, ReadonlySpan<Operand> arguments)
+static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& interpreter, Bytecode::Builtin builtin, Value this_value, ReadonlySpan<Operand> arguments)
 {
     switch (builtin) {
     case Builtin::MathAbs:
@@ -2562,22 +2564,59 @@ static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& int
         return TRY(MathObject::round_impl(interpreter.vm(), interpreter.get(arguments[0])));
     case Builtin::MathSqrt:
         return TRY(MathObject::sqrt_impl(interpreter.vm(), interpreter.get(arguments[0])));
+    case Builtin::MathMin:
+        return TRY(MathObject::min_impl(interpreter.vm(), interpreter.get(arguments[0]), interpreter.get(arguments[1])));
+    case Builtin::MathMax:
+        return TRY(MathObject::max_impl(interpreter.vm(), interpreter.get(arguments[0]), interpreter.get(arguments[1])));
+    case Builtin::ObjectHasOwn:
+        return TRY(ObjectConstructor::has_own_impl(interpreter.vm(), interpreter.get(arguments[0]), interpreter.get(arguments[1])));
+    case Builtin::ArrayIsArray:
+        return Value(TRY(interpreter.get(arguments[0]).is_array(interpreter.vm())));
+    case Builtin::StringPrototypeCharCodeAt:
+        return TRY(StringPrototype::char_code_at_impl(interpreter.vm(), this_value, interpreter.get(arguments[0])));
+    case Builtin::ArrayPrototypePush: {
+        auto value = interpreter.get(arguments[0]);
+        if (this_value.is_object() && is<Array>(this_value.as_object())) {
+            auto& array = static_cast<Array&>(this_value.as_object());
+            if (array.try_append_without_side_effects(value))
+                return Value(array.indexed_properties().array_like_size());
+        }
+        return TRY(JS::call(interpreter.vm(), *interpreter.realm().get_builtin_value(builtin), this_value, value));
+    }
     case Bytecode::Builtin::__Count:
         VERIFY_NOT_REACHED();
     }
     VERIFY_NOT_REACHED();
 }
 
-ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) const
+static ThrowCompletionOr<Value> perform_call_with_call_site_cache(Bytecode::Interpreter& interpreter, CallSiteCache& cache, Value callee, Value this_value, ReadonlySpan<Operand> arguments, Optional<StringTableIndex> const& expression_string)
 {
-    auto callee = interpreter.get(m_callee);
+    // OPTIMIZATION: Call sites tend to be monomorphic. If this one targets the same ECMAScript function as last time,
+    //               we already know it's callable, and can copy the arguments straight into the callee context.
+    if (callee.is_object() && cache.callee.ptr() == &callee.as_object()) {
+        auto& function = *cache.callee;
+        auto callee_context = ExecutionContext::create();
+        callee_context->arguments.ensure_capacity(max(arguments.size(), function.formal_parameters().size()));
+        for (auto argument : arguments)
+            callee_context->arguments.unchecked_append(interpreter.get(argument));
+        return function.call_with_prepared_arguments(move(callee_context), this_value);
+    }
 
-    TRY(throw_if_needed_for_call(interpreter, callee, CallType::Call, expression_string()));
+    TRY(throw_if_needed_for_call(interpreter, callee, CallType::Call, expression_string));
 
-    auto argument_values = interpreter.allocate_argument_values(m_argument_count);
-    for (size_t i = 0; i < m_argument_count; ++i)
-        argument_values[i] = interpreter.get(m_arguments[i]);
-    interpreter.set(dst(), TRY(perform_call(interpreter, interpreter.get(m_this_value), CallType::Call, callee, argument_values)));
+    if (is<ECMAScriptFunctionObject>(callee.as_object()))
+        cache.callee = static_cast<ECMAScriptFunctionObject&>(callee.as_object());
+
+    auto argument_values = interpreter.allocate_argument_values(arguments.size());
+    for (size_t i = 0; i < arguments.size(); ++i)
+        argument_values[i] = interpreter.get(arguments[i]);
+    return perform_call(interpreter, this_value, CallType::Call, callee, argument_values);
+}
+
+ThrowCompletionOr<void> Call::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& cache = interpreter.current_executable().call_site_caches[m_cache_index];
+    interpreter.set(dst(), TRY(perform_call_with_call_site_cache(interpreter, cache, interpreter.get(m_callee), interpreter.get(m_this_value), { m_arguments, m_argument_count }, expression_string())));
     return {};
 }
 
@@ -2611,18 +2650,16 @@ ThrowCompletionOr<void> CallBuiltin::execute_impl(Bytecode::Interpreter& interpr
 {
     auto callee = interpreter.get(m_callee);
 
-    TRY(throw_if_needed_for_call(interpreter, callee, CallType::Call, expression_string()));
-
     if (m_argument_count == Bytecode::builtin_argument_count(m_builtin) && callee.is_object() && interpreter.realm().get_builtin_value(m_builtin) == &callee.as_object()) {
-        interpreter.set(dst(), TRY(dispatch_builtin_call(interpreter, m_builtin, { m_arguments, m_argument_count })));
+        interpreter.set(dst(), TRY(dispatch_builtin_call(interpreter, m_builtin, interpreter.get(m_this_value), { m_arguments, m_argument_count })));
 
         return {};
     }
 
-    auto argument_values = interpreter.allocate_argument_values(m_argument_count);
-    for (size_t i = 0; i < m_argument_count; ++i)
-        argument_values[i] = interpreter.get(m_arguments[i]);
-    interpreter.set(dst(), TRY(perform_call(interpreter, interpreter.get(m_this_value), CallType::Call, callee, argument_values)));
+    // NOTE: Prototype builtins are selected by property name alone, so this is also the path for user-defined methods
+    //       that happen to share a builtin's name (e.g. a custom push()), which should still get the call site cache.
+    auto& cache = interpreter.current_executable().call_site_caches[m_cache_index];
+    interpreter.set(dst(), TRY(perform_call_with_call_site_cache(interpreter, cache, callee, interpreter.get(m_this_value), { m_arguments, m_argument_count }, expression_string())));
     return {};
 }
 
@@ -3376,6 +3413,8 @@ ByteString Call::to_byte_string_impl(Bytecode::Executable const& executable) con
 
     builder.append(format_operand_list("args"sv, { m_arguments, m_argument_count }, executable));
 
+    builder.appendff(", (cache:{})", m_cache_index);
+
     if (m_expression_string.has_value()) {
         builder.appendff(", `{}`", executable.get_string(m_expression_string.value()));
     }
@@ -3427,7 +3466,7 @@ ByteString CallBuiltin::to_byte_string_impl(Bytecode::Executable const& executab
 
     builder.append(format_operand_list("args"sv, { m_arguments, m_argument_count }, executable));
 
-    builder.appendff(", (builtin:{})", m_builtin);
+    builder.appendff(", (builtin:{}), (cache:{})", m_builtin, m_cache_index);
 
     if (m_expression_string.has_value()) {
         builder.appendff(", `{}`", executable.get_string(m_expression_string.value()));
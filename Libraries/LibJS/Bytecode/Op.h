@@ -1750,12 +1750,13 @@ class Call final : public Instruction {
 public:
     static constexpr bool IsVariableLength = true;
 
-    Call(Operand dst, Operand callee, Operand this_value, ReadonlySpan<ScopedOperand> arguments, Optional<StringTableIndex> expression_string = {})
+    Call(Operand dst, Operand callee, Operand this_value, ReadonlySpan<ScopedOperand> arguments, u32 cache_index, Optional<StringTableIndex> expression_string = {})
         : Instruction(Type::Call)
         , m_dst(dst)
         , m_callee(callee)
         , m_this_value(this_value)
         , m_argument_count(arguments.size())
+        , m_cache_index(cache_index)
         , m_expression_string(expression_string)
     {
         for (size_t i = 0; i < arguments.size(); ++i)
@@ -1773,6 +1774,7 @@ public:
     Optional<StringTableIndex> const& expression_string() const { return m_expression_string; }
 
     u32 argument_count() const { return m_argument_count; }
+    u32 cache_index() const { return m_cache_index; }
 
     ThrowCompletionOr<void> execute_impl(Bytecode::Interpreter&) const;
     ByteString to_byte_string_impl(Bytecode::Executable const&) const;
@@ -1790,6 +1792,7 @@ private:
     Operand m_callee;
     Operand m_this_value;
     u32 m_argument_count { 0 };
+    u32 m_cache_index { 0 };
     Optional<StringTableIndex> m_expression_string;
     Operand m_arguments[];
 };
@@ -1798,13 +1801,14 @@ class CallBuiltin final : public Instruction {
 public:
     static constexpr bool IsVariableLength = true;
 
-    CallBuiltin(Operand dst, Operand callee, Operand this_value, ReadonlySpan<ScopedOperand> arguments, Builtin builtin, Optional<StringTableIndex> expression_string = {})
+    CallBuiltin(Operand dst, Operand callee, Operand this_value, ReadonlySpan<ScopedOperand> arguments, Builtin builtin, u32 cache_index, Optional<StringTableIndex> expression_string = {})
         : Instruction(Type::CallBuiltin)
         , m_dst(dst)
         , m_callee(callee)
         , m_this_value(this_value)
         , m_argument_count(arguments.size())
         , m_builtin(builtin)
+        , m_cache_index(cache_index)
         , m_expression_string(expression_string)
     {
         for (size_t i = 0; i < arguments.size(); ++i)
@@ -1824,6 +1828,7 @@ public:
     u32 argument_count() const { return m_argument_count; }
 
     Builtin const& builtin() const { return m_builtin; }
+    u32 cache_index() const { return m_cache_index; }
 
     ThrowCompletionOr<void> execute_impl(Bytecode::Interpreter&) const;
     ByteString to_byte_string_impl(Bytecode::Executable const&) const;
@@ -1842,6 +1847,7 @@ private:
     Operand m_this_value;
     u32 m_argument_count { 0 };
     Builtin m_builtin;
+    u32 m_cache_index { 0 };
     Optional<StringTableIndex> m_expression_string;
     Operand m_arguments[];
 };
@@ -12,6 +12,7 @@
 #include <LibJS/Runtime/Completion.h>
 #include <LibJS/Runtime/Error.h>
 #include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/Intrinsics.h>
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/ValueInlines.h>
 
@@ -69,6 +70,29 @@ Array::Array(Object& prototype)
     m_has_magical_length_property = true;
 }
 
+bool Array::try_append_without_side_effects(Value value)
+{
+    if (!m_is_extensible || !m_length_writable || may_interfere_with_indexed_property_access())
+        return false;
+
+    auto const* storage = indexed_properties().storage();
+    if (storage && (!storage->is_simple_storage() || storage->array_like_size() >= NumericLimits<u32>::max()))
+        return false;
+
+    // [[Set]] would consult the prototype chain for the new index, so we only allow the default one, and only while
+    // neither of its objects has any indexed properties of its own.
+    auto& intrinsics = shape().realm().intrinsics();
+    auto const* array_prototype = shape().prototype();
+    if (array_prototype != intrinsics.array_prototype().ptr() || !array_prototype->indexed_properties().is_empty())
+        return false;
+    auto const* object_prototype = array_prototype->prototype();
+    if (object_prototype != intrinsics.object_prototype().ptr() || !object_prototype->indexed_properties().is_empty())
+        return false;
+
+    indexed_properties().append(value);
+    return true;
+}
+
 // 10.4.2.4 ArraySetLength ( A, Desc ), https://tc39.es/ecma262/#sec-arraysetlength
 ThrowCompletionOr<bool> Array::set_length(PropertyDescriptor const& property_descriptor)
 {
@@ -54,6 +54,10 @@ public:
 
     [[nodiscard]] bool length_is_writable() const { return m_length_writable; }
 
+    // Non-standard: Appends a value without going through [[Set]], as long as nothing could observe the difference.
+    //               Returns false without touching the array otherwise, in which case the caller must take the slow path.
+    [[nodiscard]] bool try_append_without_side_effects(Value);
+
 protected:
     explicit Array(Object& prototype);
 
@@ -40,7 +40,7 @@ void ArrayConstructor::initialize(Realm& realm)
     u8 attr = Attribute::Writable | Attribute::Configurable;
     define_native_function(realm, vm.names.from, from, 1, attr);
     define_native_function(realm, vm.names.fromAsync, from_async, 1, attr);
-    define_native_function(realm, vm.names.isArray, is_array, 1, attr);
+    define_native_function(realm, vm.names.isArray, is_array, 1, attr, Bytecode::Builtin::ArrayIsArray);
     define_native_function(realm, vm.names.of, of, 0, attr);
 
     // 23.1.2.5 get Array [ @@species ], https://tc39.es/ecma262/#sec-get-array-@@species
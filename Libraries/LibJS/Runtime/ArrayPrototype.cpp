@@ -63,7 +63,7 @@ void ArrayPrototype::initialize(Realm& realm)
     define_native_function(realm, vm.names.lastIndexOf, last_index_of, 1, attr);
     define_native_function(realm, vm.names.map, map, 1, attr);
     define_native_function(realm, vm.names.pop, pop, 0, attr);
-    define_native_function(realm, vm.names.push, push, 1, attr);
+    define_native_function(realm, vm.names.push, push, 1, attr, Bytecode::Builtin::ArrayPrototypePush);
     define_native_function(realm, vm.names.reduce, reduce, 1, attr);
     define_native_function(realm, vm.names.reduceRight, reduce_right, 1, attr);
     define_native_function(realm, vm.names.reverse, reverse, 0, attr);
@@ -49,65 +49,73 @@ ThrowCompletionOr<void> AsyncFunctionDriverWrapper::await(JS::Value value)
     // 2. Let promise be ? PromiseResolve(%Promise%, value).
     auto* promise_object = TRY(promise_resolve(vm, realm.intrinsics().promise_constructor(), value));
 
-    // 3. Let fulfilledClosure be a new Abstract Closure with parameters (v) that captures asyncContext and performs the
-    //    following steps when called:
-    auto fulfilled_closure = [this](VM& vm) -> ThrowCompletionOr<Value> {
-        auto value = vm.argument(0);
-
-        // a. Let prevContext be the running execution context.
-        auto& prev_context = vm.running_execution_context();
-
-        // b. Suspend prevContext.
-        // c. Push asyncContext onto the execution context stack; asyncContext is now the running execution context.
-        TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
-
-        // d. Resume the suspended evaluation of asyncContext using NormalCompletion(v) as the result of the operation that
-        //    suspended it.
-        continue_async_execution(vm, value, true);
-        vm.pop_execution_context();
-
-        // e. Assert: When we reach this step, asyncContext has already been removed from the execution context stack and
-        //    prevContext is the currently running execution context.
-        VERIFY(&vm.running_execution_context() == &prev_context);
-
-        // f. Return undefined.
-        return js_undefined();
-    };
-
-    // 4. Let onFulfilled be CreateBuiltinFunction(fulfilledClosure, 1, "", « »).
-    auto on_fulfilled = NativeFunction::create(realm, move(fulfilled_closure), 1, "");
-
-    // 5. Let rejectedClosure be a new Abstract Closure with parameters (reason) that captures asyncContext and performs the
-    //    following steps when called:
-    auto rejected_closure = [this](VM& vm) -> ThrowCompletionOr<Value> {
-        auto reason = vm.argument(0);
-
-        // a. Let prevContext be the running execution context.
-        auto& prev_context = vm.running_execution_context();
-
-        // b. Suspend prevContext.
-        // c. Push asyncContext onto the execution context stack; asyncContext is now the running execution context.
-        TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
-
-        // d. Resume the suspended evaluation of asyncContext using ThrowCompletion(reason) as the result of the operation that
-        //    suspended it.
-        continue_async_execution(vm, reason, false);
-        vm.pop_execution_context();
-
-        // e. Assert: When we reach this step, asyncContext has already been removed from the execution context stack and
-        //    prevContext is the currently running execution context.
-        VERIFY(&vm.running_execution_context() == &prev_context);
-
-        // f. Return undefined.
-        return js_undefined();
-    };
-
-    // 6. Let onRejected be CreateBuiltinFunction(rejectedClosure, 1, "", « »).
-    auto on_rejected = NativeFunction::create(realm, move(rejected_closure), 1, "");
+    // NOTE: The closures in steps 3-6 only capture asyncContext, which is the same for every await in this function
+    //       activation, and they are never exposed to user code. We create them on the first await and reuse them for
+    //       every subsequent one, instead of allocating two new builtin functions per await.
+    if (!m_on_fulfilled) {
+        // 3. Let fulfilledClosure be a new Abstract Closure with parameters (v) that captures asyncContext and performs the
+        //    following steps when called:
+        auto fulfilled_closure = [this](VM& vm) -> ThrowCompletionOr<Value> {
+            auto value = vm.argument(0);
+
+            // a. Let prevContext be the running execution context.
+            auto& prev_context = vm.running_execution_context();
+
+            // b. Suspend prevContext.
+            // c. Push asyncContext onto the execution context stack; asyncContext is now the running execution context.
+            TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
+
+            // d. Resume the suspended evaluation of asyncContext using NormalCompletion(v) as the result of the operation that
+            //    suspended it.
+            continue_async_execution(vm, value, true);
+            vm.pop_execution_context();
+
+            // e. Assert: When we reach this step, asyncContext has already been removed from the execution context stack and
+            //    prevContext is the currently running execution context.
+            VERIFY(&vm.running_execution_context() == &prev_context);
+
+            // f. Return undefined.
+            return js_undefined();
+        };
+
+        // 4. Let onFulfilled be CreateBuiltinFunction(fulfilledClosure, 1, "", « »).
+        auto on_fulfilled = NativeFunction::create(realm, move(fulfilled_closure), 1, "");
+
+        // 5. Let rejectedClosure be a new Abstract Closure with parameters (reason) that captures asyncContext and performs the
+        //    following steps when called:
+        auto rejected_closure = [this](VM& vm) -> ThrowCompletionOr<Value> {
+            auto reason = vm.argument(0);
+
+            // a. Let prevContext be the running execution context.
+            auto& prev_context = vm.running_execution_context();
+
+            // b. Suspend prevContext.
+            // c. Push asyncContext onto the execution context stack; asyncContext is now the running execution context.
+            TRY(vm.push_execution_context(*m_suspended_execution_context, {}));
+
+            // d. Resume the suspended evaluation of asyncContext using ThrowCompletion(reason) as the result of the operation that
+            //    suspended it.
+            continue_async_execution(vm, reason, false);
+            vm.pop_execution_context();
+
+            // e. Assert: When we reach this step, asyncContext has already been removed from the execution context stack and
+            //    prevContext is the currently running execution context.
+            VERIFY(&vm.running_execution_context() == &prev_context);
+
+            // f. Return undefined.
+            return js_undefined();
+        };
+
+        // 6. Let onRejected be CreateBuiltinFunction(rejectedClosure, 1, "", « »).
+        auto on_rejected = NativeFunction::create(realm, move(rejected_closure), 1, "");
+
+        m_on_fulfilled = on_fulfilled;
+        m_on_rejected = on_rejected;
+    }
 
     // 7. Perform PerformPromiseThen(promise, onFulfilled, onRejected).
     m_current_promise = as<Promise>(promise_object);
-    m_current_promise->perform_then(on_fulfilled, on_rejected, {});
+    m_current_promise->perform_then(m_on_fulfilled, m_on_rejected, {});
 
     // NOTE: None of these are necessary. 8-12 are handled by step d of the above lambdas.
     // 8. Remove asyncContext from the execution context stack and restore the execution context that is at the top of the
@@ -177,6 +185,8 @@ void AsyncFunctionDriverWrapper::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_top_level_promise);
     if (m_current_promise)
         visitor.visit(m_current_promise);
+    visitor.visit(m_on_fulfilled);
+    visitor.visit(m_on_rejected);
     if (m_suspended_execution_context)
         m_suspended_execution_context->visit_edges(visitor);
 }
@@ -33,6 +33,8 @@ private:
     GC::Ref<GeneratorObject> m_generator_object;
     GC::Ref<Promise> m_top_level_promise;
     GC::Ptr<Promise> m_current_promise { nullptr };
+    GC::Ptr<NativeFunction> m_on_fulfilled;
+    GC::Ptr<NativeFunction> m_on_rejected;
     OwnPtr<ExecutionContext> m_suspended_execution_context;
 };
 
@@ -376,20 +376,28 @@ void ECMAScriptFunctionObject::initialize(Realm& realm)
 
 // 10.2.1 [[Call]] ( thisArgument, argumentsList ), https://tc39.es/ecma262/#sec-ecmascript-function-objects-call-thisargument-argumentslist
 ThrowCompletionOr<Value> ECMAScriptFunctionObject::internal_call(Value this_argument, ReadonlySpan<Value> arguments_list)
+{
+    auto callee_context = ExecutionContext::create();
+
+    // Non-standard
+    callee_context->arguments.ensure_capacity(max(arguments_list.size(), m_formal_parameters.size()));
+    callee_context->arguments.append(arguments_list.data(), arguments_list.size());
+
+    return call_with_prepared_arguments(move(callee_context), this_argument);
+}
+
+ThrowCompletionOr<Value> ECMAScriptFunctionObject::call_with_prepared_arguments(NonnullOwnPtr<ExecutionContext> callee_context, Value this_argument)
 {
     auto& vm = this->vm();
 
     // 1. Let callerContext be the running execution context.
     // NOTE: No-op, kept by the VM in its execution context stack.
 
-    auto callee_context = ExecutionContext::create();
-
     // Non-standard
-    callee_context->arguments.ensure_capacity(max(arguments_list.size(), m_formal_parameters.size()));
-    callee_context->arguments.append(arguments_list.data(), arguments_list.size());
-    callee_context->passed_argument_count = arguments_list.size();
-    if (arguments_list.size() < m_formal_parameters.size()) {
-        for (size_t i = arguments_list.size(); i < m_formal_parameters.size(); ++i)
+    auto passed_argument_count = callee_context->arguments.size();
+    callee_context->passed_argument_count = passed_argument_count;
+    if (passed_argument_count < m_formal_parameters.size()) {
+        for (size_t i = passed_argument_count; i < m_formal_parameters.size(); ++i)
             callee_context->arguments.append(js_undefined());
     }
 
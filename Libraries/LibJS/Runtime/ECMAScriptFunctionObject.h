@@ -48,6 +48,9 @@ public:
     virtual ThrowCompletionOr<Value> internal_call(Value this_argument, ReadonlySpan<Value> arguments_list) override;
     virtual ThrowCompletionOr<GC::Ref<Object>> internal_construct(ReadonlySpan<Value> arguments_list, FunctionObject& new_target) override;
 
+    // Non-standard: [[Call]] for callers that have already placed the arguments in the callee context.
+    ThrowCompletionOr<Value> call_with_prepared_arguments(NonnullOwnPtr<ExecutionContext>, Value this_argument);
+
     void make_method(Object& home_object);
 
     [[nodiscard]] bool is_module_wrapper() const { return m_is_module_wrapper; }
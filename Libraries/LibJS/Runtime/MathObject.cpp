@@ -35,8 +35,8 @@ void MathObject::initialize(Realm& realm)
     define_native_function(realm, vm.names.floor, floor, 1, attr, Bytecode::Builtin::MathFloor);
     define_native_function(realm, vm.names.ceil, ceil, 1, attr, Bytecode::Builtin::MathCeil);
     define_native_function(realm, vm.names.round, round, 1, attr, Bytecode::Builtin::MathRound);
-    define_native_function(realm, vm.names.max, max, 2, attr);
-    define_native_function(realm, vm.names.min, min, 2, attr);
+    define_native_function(realm, vm.names.max, max, 2, attr, Bytecode::Builtin::MathMax);
+    define_native_function(realm, vm.names.min, min, 2, attr, Bytecode::Builtin::MathMin);
     define_native_function(realm, vm.names.trunc, trunc, 1, attr);
     define_native_function(realm, vm.names.sin, sin, 1, attr);
     define_native_function(realm, vm.names.cos, cos, 1, attr);
@@ -703,6 +703,39 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::log2)
     return Value(::log2(number.as_double()));
 }
 
+// 21.3.2.24 Math.max ( ...args ), https://tc39.es/ecma262/#sec-math.max
+// NOTE: Specialized for exactly two arguments, so the bytecode interpreter can inline calls without an argument list.
+ThrowCompletionOr<Value> MathObject::max_impl(VM& vm, Value value1, Value value2)
+{
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (value1.is_int32() && value2.is_int32())
+        return Value(AK::max(value1.as_i32(), value2.as_i32()));
+
+    // 1. Let coerced be a new empty List.
+    // 2. For each element arg of args, do
+    //     a. Let n be ? ToNumber(arg).
+    //     b. Append n to coerced.
+    Value coerced[] = { TRY(value1.to_number(vm)), TRY(value2.to_number(vm)) };
+
+    // 3. Let highest be -∞𝔽.
+    auto highest = js_negative_infinity();
+
+    // 4. For each element number of coerced, do
+    for (auto number : coerced) {
+        // a. If number is NaN, return NaN.
+        if (number.is_nan())
+            return js_nan();
+
+        // b. If number is +0𝔽 and highest is -0𝔽, set highest to +0𝔽.
+        // c. If number > highest, set highest to number.
+        if ((number.is_positive_zero() && highest.is_negative_zero()) || number.as_double() > highest.as_double())
+            highest = number;
+    }
+
+    // 5. Return highest.
+    return highest;
+}
+
 // 21.3.2.24 Math.max ( ...args ), https://tc39.es/ecma262/#sec-math.max
 JS_DEFINE_NATIVE_FUNCTION(MathObject::max)
 {
@@ -737,6 +770,39 @@ JS_DEFINE_NATIVE_FUNCTION(MathObject::max)
     return highest;
 }
 
+// 21.3.2.25 Math.min ( ...args ), https://tc39.es/ecma262/#sec-math.min
+// NOTE: Specialized for exactly two arguments, so the bytecode interpreter can inline calls without an argument list.
+ThrowCompletionOr<Value> MathObject::min_impl(VM& vm, Value value1, Value value2)
+{
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (value1.is_int32() && value2.is_int32())
+        return Value(AK::min(value1.as_i32(), value2.as_i32()));
+
+    // 1. Let coerced be a new empty List.
+    // 2. For each element arg of args, do
+    //     a. Let n be ? ToNumber(arg).
+    //     b. Append n to coerced.
+    Value coerced[] = { TRY(value1.to_number(vm)), TRY(value2.to_number(vm)) };
+
+    // 3. Let lowest be +∞𝔽.
+    auto lowest = js_infinity();
+
+    // 4. For each element number of coerced, do
+    for (auto number : coerced) {
+        // a. If number is NaN, return NaN.
+        if (number.is_nan())
+            return js_nan();
+
+        // b. If number is -0𝔽 and lowest is +0𝔽, set lowest to -0𝔽.
+        // c. If number < lowest, set lowest to number.
+        if ((number.is_negative_zero() && lowest.is_positive_zero()) || number.as_double() < lowest.as_double())
+            lowest = number;
+    }
+
+    // 5. Return lowest.
+    return lowest;
+}
+
 // 21.3.2.25 Math.min ( ...args ), https://tc39.es/ecma262/#sec-math.min
 JS_DEFINE_NATIVE_FUNCTION(MathObject::min)
 {
@@ -26,6 +26,8 @@ public:
     static ThrowCompletionOr<Value> round_impl(VM&, Value);
     static ThrowCompletionOr<Value> exp_impl(VM&, Value);
     static ThrowCompletionOr<Value> abs_impl(VM&, Value);
+    static ThrowCompletionOr<Value> max_impl(VM&, Value, Value);
+    static ThrowCompletionOr<Value> min_impl(VM&, Value, Value);
 
 private:
     explicit MathObject(Realm&);
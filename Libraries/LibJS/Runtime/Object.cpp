@@ -1195,10 +1195,17 @@ void Object::storage_set(PropertyKey const& property_key, ValueAndAttributes con
         if (!m_shape->is_dictionary() && m_shape->property_count() >= max_transitions_before_converting_to_dictionary)
             set_shape(m_shape->create_cacheable_dictionary_transition());
 
-        if (m_shape->is_dictionary())
-            m_shape->add_property_without_transition(property_key_string_or_symbol, attributes);
-        else
+        if (m_shape->is_dictionary()) {
+            auto offset = m_shape->add_property_without_transition(property_key_string_or_symbol, attributes);
+            if (offset < m_storage.size()) {
+                // Reuse a hole left behind by a deletion.
+                m_storage[offset] = value;
+                return;
+            }
+            VERIFY(offset == m_storage.size());
+        } else {
             set_shape(*m_shape->create_put_transition(property_key_string_or_symbol, attributes));
+        }
         m_storage.append(value);
         return;
     }
@@ -1228,12 +1235,11 @@ void Object::storage_delete(PropertyKey const& property_key)
     auto metadata = shape().lookup(property_key.to_string_or_symbol());
     VERIFY(metadata.has_value());
 
-    if (m_shape->is_cacheable_dictionary()) {
+    if (m_shape->is_dictionary()) {
+        // NOTE: Inline caches may still refer to the current shape, so the property is removed from a copy of it.
         m_shape = m_shape->create_uncacheable_dictionary_transition();
-    }
-    if (m_shape->is_uncacheable_dictionary()) {
         m_shape->remove_property_without_transition(property_key.to_string_or_symbol(), metadata->offset);
-        m_storage.remove(metadata->offset);
+        m_storage[metadata->offset] = js_undefined();
         return;
     }
     m_shape = m_shape->create_delete_transition(property_key.to_string_or_symbol());
@@ -1244,9 +1250,26 @@ void Object::set_prototype(Object* new_prototype)
 {
     if (prototype() == new_prototype)
         return;
+    compact_dictionary_storage_if_needed();
     m_shape = shape().create_prototype_transition(new_prototype);
 }
 
+void Object::compact_dictionary_storage_if_needed()
+{
+    if (!m_shape->has_dictionary_holes())
+        return;
+
+    // NOTE: Compacting renumbers offsets, so it must not happen to a shape that inline caches may still refer to.
+    m_shape = m_shape->create_uncacheable_dictionary_transition();
+
+    Vector<Value> compacted_storage;
+    compacted_storage.ensure_capacity(m_shape->property_count());
+    m_shape->compact_dictionary_offsets([&](u32 old_offset) {
+        compacted_storage.unchecked_append(m_storage[old_offset]);
+    });
+    m_storage = move(compacted_storage);
+}
+
 void Object::define_native_accessor(Realm& realm, PropertyKey const& property_key, Function<ThrowCompletionOr<Value>(VM&)> getter, Function<ThrowCompletionOr<Value>(VM&)> setter, PropertyAttributes attribute)
 {
     FunctionObject* getter_function = nullptr;
@@ -1451,6 +1474,7 @@ void Object::convert_to_prototype_if_needed()
 {
     if (shape().is_prototype_shape())
         return;
+    compact_dictionary_storage_if_needed();
     set_shape(shape().clone_for_prototype());
 }
 
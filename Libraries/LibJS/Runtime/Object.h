@@ -253,6 +253,7 @@ protected:
 
 private:
     void set_shape(Shape& shape) { m_shape = &shape; }
+    void compact_dictionary_storage_if_needed();
 
     Object* prototype() { return shape().prototype(); }
 
@@ -54,7 +54,7 @@ void ObjectConstructor::initialize(Realm& realm)
     define_native_function(realm, vm.names.values, values, 1, attr);
     define_native_function(realm, vm.names.entries, entries, 1, attr);
     define_native_function(realm, vm.names.create, create, 2, attr);
-    define_native_function(realm, vm.names.hasOwn, has_own, 2, attr);
+    define_native_function(realm, vm.names.hasOwn, has_own, 2, attr, Bytecode::Builtin::ObjectHasOwn);
     define_native_function(realm, vm.names.assign, assign, 2, attr);
 
     define_direct_property(vm.names.length, Value(1), Attribute::Configurable);
@@ -401,18 +401,23 @@ JS_DEFINE_NATIVE_FUNCTION(ObjectConstructor::group_by)
 }
 
 // 20.1.2.14 Object.hasOwn ( O, P ), https://tc39.es/ecma262/#sec-object.hasown
-JS_DEFINE_NATIVE_FUNCTION(ObjectConstructor::has_own)
+ThrowCompletionOr<Value> ObjectConstructor::has_own_impl(VM& vm, Value object_value, Value property)
 {
     // 1. Let obj be ? ToObject(O).
-    auto object = TRY(vm.argument(0).to_object(vm));
+    auto object = TRY(object_value.to_object(vm));
 
     // 2. Let key be ? ToPropertyKey(P).
-    auto key = TRY(vm.argument(1).to_property_key(vm));
+    auto key = TRY(property.to_property_key(vm));
 
     // 3. Return ? HasOwnProperty(obj, key).
     return Value(TRY(object->has_own_property(key)));
 }
 
+JS_DEFINE_NATIVE_FUNCTION(ObjectConstructor::has_own)
+{
+    return has_own_impl(vm, vm.argument(0), vm.argument(1));
+}
+
 // 20.1.2.15 Object.is ( value1, value2 ), https://tc39.es/ecma262/#sec-object.is
 JS_DEFINE_NATIVE_FUNCTION(ObjectConstructor::is)
 {
@@ -46,6 +46,8 @@ GC::Ref<Shape> Shape::create_uncacheable_dictionary_transition()
     new_shape->ensure_property_table();
     (*new_shape->m_property_table) = *m_property_table;
     new_shape->m_property_count = new_shape->m_property_table->size();
+    if (has_dictionary_holes())
+        new_shape->m_free_dictionary_offsets = make<Vector<u32>>(*m_free_dictionary_offsets);
     return new_shape;
 }
 
@@ -282,18 +284,24 @@ GC::Ref<Shape> Shape::create_delete_transition(StringOrSymbol const& property_ke
     return new_shape;
 }
 
-void Shape::add_property_without_transition(StringOrSymbol const& property_key, PropertyAttributes attributes)
+u32 Shape::add_property_without_transition(StringOrSymbol const& property_key, PropertyAttributes attributes)
 {
     ensure_property_table();
-    if (m_property_table->set(property_key, { m_property_count, attributes }) == AK::HashSetResult::InsertedNewEntry) {
-        VERIFY(m_property_count < NumericLimits<u32>::max());
-        ++m_property_count;
+    if (auto it = m_property_table->find(property_key); it != m_property_table->end()) {
+        it->value.attributes = attributes;
+        return it->value.offset;
     }
+
+    auto offset = has_dictionary_holes() ? m_free_dictionary_offsets->take_last() : m_property_count;
+    m_property_table->set(property_key, { offset, attributes });
+    VERIFY(m_property_count < NumericLimits<u32>::max());
+    ++m_property_count;
+    return offset;
 }
 
-FLATTEN void Shape::add_property_without_transition(PropertyKey const& property_key, PropertyAttributes attributes)
+FLATTEN u32 Shape::add_property_without_transition(PropertyKey const& property_key, PropertyAttributes attributes)
 {
-    add_property_without_transition(property_key.to_string_or_symbol(), attributes);
+    return add_property_without_transition(property_key.to_string_or_symbol(), attributes);
 }
 
 void Shape::set_property_attributes_without_transition(StringOrSymbol const& property_key, PropertyAttributes attributes)
@@ -308,15 +316,29 @@ void Shape::set_property_attributes_without_transition(StringOrSymbol const& pro
 
 void Shape::remove_property_without_transition(StringOrSymbol const& property_key, u32 offset)
 {
-    VERIFY(is_uncacheable_dictionary());
+    VERIFY(is_dictionary());
+    VERIFY(m_property_table);
+    if (!m_property_table->remove(property_key))
+        return;
+    --m_property_count;
+
+    // NOTE: Rather than renumbering every following property (and shifting the object's storage to match), which
+    //       makes deleting from large dictionaries quadratic, we leave a hole that the next added property reuses.
+    if (!m_free_dictionary_offsets)
+        m_free_dictionary_offsets = make<Vector<u32>>();
+    m_free_dictionary_offsets->append(offset);
+}
+
+void Shape::compact_dictionary_offsets(Function<void(u32 old_offset)> const& callback)
+{
+    VERIFY(is_dictionary());
     VERIFY(m_property_table);
-    if (m_property_table->remove(property_key))
-        --m_property_count;
+    u32 next_offset = 0;
     for (auto& it : *m_property_table) {
-        VERIFY(it.value.offset != offset);
-        if (it.value.offset > offset)
-            --it.value.offset;
+        callback(it.value.offset);
+        it.value.offset = next_offset++;
     }
+    m_free_dictionary_offsets = nullptr;
 }
 
 GC::Ref<Shape> Shape::create_for_prototype(GC::Ref<Realm> realm, GC::Ptr<Object> prototype)
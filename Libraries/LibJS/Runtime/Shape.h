@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Function.h>
 #include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <AK/StringView.h>
@@ -73,12 +74,19 @@ public:
     [[nodiscard]] GC::Ref<Shape> clone_for_prototype();
     [[nodiscard]] static GC::Ref<Shape> create_for_prototype(GC::Ref<Realm>, GC::Ptr<Object> prototype);
 
-    void add_property_without_transition(StringOrSymbol const&, PropertyAttributes);
-    void add_property_without_transition(PropertyKey const&, PropertyAttributes);
+    // Returns the storage offset assigned to the new property.
+    u32 add_property_without_transition(StringOrSymbol const&, PropertyAttributes);
+    u32 add_property_without_transition(PropertyKey const&, PropertyAttributes);
 
     void remove_property_without_transition(StringOrSymbol const&, u32 offset);
     void set_property_attributes_without_transition(StringOrSymbol const&, PropertyAttributes);
 
+    // Dictionaries leave a hole in the owning object's storage when a property is removed, and reuse it for the next
+    // property added. Before deriving any other shape from such a dictionary, its offsets must be made
+    // dense again; the callback receives each property's old offset in the order of the new, dense offsets.
+    [[nodiscard]] bool has_dictionary_holes() const { return m_free_dictionary_offsets && !m_free_dictionary_offsets->is_empty(); }
+    void compact_dictionary_offsets(Function<void(u32 old_offset)> const&);
+
     [[nodiscard]] bool is_cacheable() const { return m_cacheable; }
     [[nodiscard]] bool is_dictionary() const { return m_dictionary; }
     [[nodiscard]] bool is_cacheable_dictionary() const { return m_dictionary && m_cacheable; }
@@ -129,6 +137,7 @@ private:
     OwnPtr<HashMap<TransitionKey, WeakPtr<Shape>>> m_forward_transitions;
     OwnPtr<HashMap<GC::Ptr<Object>, WeakPtr<Shape>>> m_prototype_transitions;
     OwnPtr<HashMap<StringOrSymbol, WeakPtr<Shape>>> m_delete_transitions;
+    OwnPtr<Vector<u32>> m_free_dictionary_offsets;
     GC::Ptr<Shape> m_previous;
     StringOrSymbol m_property_key;
     GC::Ptr<Object> m_prototype;
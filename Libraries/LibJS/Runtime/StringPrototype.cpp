@@ -156,7 +156,7 @@ void StringPrototype::initialize(Realm& realm)
     // 22.1.3 Properties of the String Prototype Object, https://tc39.es/ecma262/#sec-properties-of-the-string-prototype-object
     define_native_function(realm, vm.names.at, at, 1, attr);
     define_native_function(realm, vm.names.charAt, char_at, 1, attr);
-    define_native_function(realm, vm.names.charCodeAt, char_code_at, 1, attr);
+    define_native_function(realm, vm.names.charCodeAt, char_code_at, 1, attr, Bytecode::Builtin::StringPrototypeCharCodeAt);
     define_native_function(realm, vm.names.codePointAt, code_point_at, 1, attr);
     define_native_function(realm, vm.names.concat, concat, 1, attr);
     define_native_function(realm, vm.names.endsWith, ends_with, 1, attr);
@@ -281,14 +281,25 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_at)
 }
 
 // 22.1.3.3 String.prototype.charCodeAt ( pos ), https://tc39.es/ecma262/#sec-string.prototype.charcodeat
-JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_code_at)
+ThrowCompletionOr<Value> StringPrototype::char_code_at_impl(VM& vm, Value this_value, Value position_value)
 {
+    // OPTIMIZATION: Fast path for primitive strings and Int32 positions, which avoids copying the string.
+    if (this_value.is_string() && position_value.is_int32()) {
+        auto string = this_value.as_string().utf16_string_view();
+        auto position = position_value.as_i32();
+        if (position < 0 || static_cast<size_t>(position) >= string.length_in_code_units())
+            return js_nan();
+        return Value(string.code_unit_at(position));
+    }
+
     // 1. Let O be ? RequireObjectCoercible(this value).
+    auto object = TRY(require_object_coercible(vm, this_value));
+
     // 2. Let S be ? ToString(O).
-    auto string = TRY(utf16_string_from(vm));
+    auto string = TRY(object.to_utf16_string(vm));
 
     // 3. Let position be ? ToIntegerOrInfinity(pos).
-    auto position = TRY(vm.argument(0).to_integer_or_infinity(vm));
+    auto position = TRY(position_value.to_integer_or_infinity(vm));
 
     // 4. Let size be the length of S.
     // 5. If position < 0 or position ≥ size, return NaN.
@@ -299,6 +310,11 @@ JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_code_at)
     return Value(string.code_unit_at(position));
 }
 
+JS_DEFINE_NATIVE_FUNCTION(StringPrototype::char_code_at)
+{
+    return char_code_at_impl(vm, vm.this_value(), vm.argument(0));
+}
+
 // 22.1.3.4 String.prototype.codePointAt ( pos ), https://tc39.es/ecma262/#sec-string.prototype.codepointat
 JS_DEFINE_NATIVE_FUNCTION(StringPrototype::code_point_at)
 {
@@ -271,7 +271,7 @@ void VM::gather_roots(HashMap<GC::Cell*, GC::HeapRoot>& roots)
     for (auto& saved_stack : m_saved_execution_context_stacks)
         gather_roots_from_execution_context_stack(saved_stack);
 
-    for (auto& job : m_promise_jobs)
+    for (auto& job : m_promise_jobs.span().slice(m_next_promise_job_index))
         roots.set(job, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
 }
 
@@ -422,12 +422,23 @@ void VM::run_queued_promise_jobs()
 {
     dbgln_if(PROMISE_DEBUG, "Running queued promise jobs");
 
-    while (!m_promise_jobs.is_empty()) {
-        auto job = m_promise_jobs.take_first();
+    // NOTE: Jobs are consumed by index rather than with take_first(), which would shift the entire queue for every
+    //       job that runs. Jobs enqueued while running are appended and picked up by this same loop. Once more than
+    //       half of the queue has been consumed, the consumed prefix is dropped so that a queue that keeps refilling
+    //       itself does not grow without bound.
+    while (m_next_promise_job_index < m_promise_jobs.size()) {
+        auto job = m_promise_jobs[m_next_promise_job_index++];
+        if (m_next_promise_job_index > m_promise_jobs.size() / 2) {
+            m_promise_jobs.remove(0, m_next_promise_job_index);
+            m_next_promise_job_index = 0;
+        }
         dbgln_if(PROMISE_DEBUG, "Calling promise job function");
 
         [[maybe_unused]] auto result = job->function()();
     }
+
+    m_promise_jobs.clear_with_capacity();
+    m_next_promise_job_index = 0;
 }
 
 // 9.5.4 HostEnqueuePromiseJob ( job, realm ), https://tc39.es/ecma262/#sec-hostenqueuepromisejob
@@ -325,6 +325,7 @@ private:
     HashMap<String, GC::Ref<Symbol>> m_global_symbol_registry;
 
     Vector<GC::Ref<GC::Function<ThrowCompletionOr<Value>()>>> m_promise_jobs;
+    size_t m_next_promise_job_index { 0 };
 
     Vector<GC::Ptr<FinalizationRegistry>> m_finalization_registry_cleanup_jobs;
 
@@ -0,0 +1,132 @@
+test("Call site cache follows a change of callee", () => {
+    function first(a, b) {
+        return a + b;
+    }
+    function second(a, b) {
+        return a * b;
+    }
+
+    let callee = first;
+    const results = [];
+    for (let i = 0; i < 4; ++i) {
+        if (i === 2) callee = second;
+        results.push(callee(3, 4));
+    }
+    expect(results).toEqual([7, 7, 12, 12]);
+});
+
+test("Call site cache pads missing arguments and keeps extra ones", () => {
+    function f(a, b, c) {
+        return [a, b, c, arguments.length];
+    }
+
+    for (let i = 0; i < 3; ++i) {
+        expect(f(1)).toEqual([1, undefined, undefined, 1]);
+        expect(f(1, 2, 3, 4)).toEqual([1, 2, 3, 4]);
+    }
+});
+
+test("Call site cache still throws for class constructors", () => {
+    class C {}
+    let callee = function () {};
+    for (let i = 0; i < 3; ++i) {
+        if (i === 2) callee = C;
+        if (i < 2) callee();
+        else expect(() => callee()).toThrowWithMessage(TypeError, "Class constructor C must be called with 'new'");
+    }
+});
+
+test("Array.prototype.push fast path respects the prototype chain", () => {
+    const array = [1, 2];
+    expect(array.push(3)).toBe(3);
+    expect(array).toEqual([1, 2, 3]);
+
+    let setterValue;
+    Object.defineProperty(Array.prototype, 3, {
+        set(value) {
+            setterValue = value;
+        },
+        configurable: true,
+    });
+    try {
+        expect(array.push(4)).toBe(4);
+        expect(setterValue).toBe(4);
+        expect(Object.hasOwn(array, 3)).toBeFalse();
+    } finally {
+        delete Array.prototype[3];
+    }
+});
+
+test("Array.prototype.push fast path respects frozen arrays and non-writable length", () => {
+    const frozen = Object.freeze([1]);
+    expect(() => frozen.push(2)).toThrow(TypeError);
+
+    const fixedLength = [1];
+    Object.defineProperty(fixedLength, "length", { writable: false });
+    expect(() => fixedLength.push(2)).toThrow(TypeError);
+    expect(fixedLength).toEqual([1]);
+});
+
+test("Builtin calls fall back to overridden functions", () => {
+    const object = { push: x => `pushed ${x}`, charCodeAt: () => "not a number" };
+    expect(object.push(1)).toBe("pushed 1");
+    expect(object.charCodeAt(0)).toBe("not a number");
+
+    const originalMin = Math.min;
+    Math.min = () => "overridden";
+    try {
+        expect(Math.min(1, 2)).toBe("overridden");
+    } finally {
+        Math.min = originalMin;
+    }
+});
+
+test("User-defined methods named like builtins switch targets correctly", () => {
+    class Stack {
+        constructor() {
+            this.items = [];
+        }
+        push(x) {
+            this.items.push(x);
+            return this.items.length;
+        }
+    }
+    const other = { push: x => -x };
+
+    function pushAll(target, count) {
+        let result;
+        for (let i = 0; i < count; ++i) result = target.push(i);
+        return result;
+    }
+
+    const stack = new Stack();
+    expect(pushAll(stack, 10)).toBe(10);
+    expect(pushAll(other, 10)).toBe(-9);
+    expect(pushAll(stack, 5)).toBe(15);
+    expect(pushAll([], 3)).toBe(3);
+    expect(pushAll(stack, 1)).toBe(16);
+});
+
+test("Inlined builtins match the generic versions", () => {
+    expect("abc".charCodeAt(1)).toBe(98);
+    expect("abc".charCodeAt(3)).toBeNaN();
+    expect("abc".charCodeAt(-1)).toBeNaN();
+    expect("abc".charCodeAt("1")).toBe(98);
+    expect(String.prototype.charCodeAt.call(123, 0)).toBe(49);
+    expect(() => String.prototype.charCodeAt.call(null, 0)).toThrow(TypeError);
+
+    expect(Math.min(1, 2)).toBe(1);
+    expect(Math.max(1, 2)).toBe(2);
+    expect(Math.min(0, -0)).toBe(-0);
+    expect(Math.max(-0, 0)).toBe(0);
+    expect(Math.min(NaN, 1)).toBeNaN();
+    expect(Math.max("3", 2)).toBe(3);
+
+    expect(Object.hasOwn({ a: 1 }, "a")).toBeTrue();
+    expect(Object.hasOwn({ a: 1 }, "b")).toBeFalse();
+    expect(() => Object.hasOwn(null, "a")).toThrow(TypeError);
+
+    expect(Array.isArray([])).toBeTrue();
+    expect(Array.isArray(new Proxy([], {}))).toBeTrue();
+    expect(Array.isArray({ length: 0 })).toBeFalse();
+});
@@ -0,0 +1,58 @@
+describe("deleting properties from dictionary-mode objects", () => {
+    function makeDictionary(count) {
+        let o = {};
+        for (let i = 0; i < count; ++i) o["key" + i] = i;
+        return o;
+    }
+
+    test("remaining properties keep their values", () => {
+        let o = makeDictionary(1000);
+        for (let i = 0; i < 1000; i += 2) delete o["key" + i];
+
+        for (let i = 0; i < 1000; ++i) {
+            if (i % 2 === 0) expect(o).not.toHaveProperty("key" + i);
+            else expect(o["key" + i]).toBe(i);
+        }
+    });
+
+    test("enumeration order is creation order after deletes and re-adds", () => {
+        let o = makeDictionary(100);
+        delete o.key10;
+        delete o.key20;
+        o.added1 = "a";
+        o.added2 = "b";
+        o.key10 = "c";
+
+        let keys = Object.keys(o);
+        expect(keys).toHaveLength(101);
+        expect(keys.slice(-3)).toEqual(["added1", "added2", "key10"]);
+        expect(o.added1).toBe("a");
+        expect(o.added2).toBe("b");
+        expect(o.key10).toBe("c");
+        expect(o.key11).toBe(11);
+    });
+
+    test("changing the prototype after deletes keeps values intact", () => {
+        let o = makeDictionary(100);
+        for (let i = 0; i < 50; ++i) delete o["key" + i];
+
+        let proto = { inherited: true };
+        Object.setPrototypeOf(o, proto);
+        o.afterPrototypeChange = "x";
+
+        expect(o.inherited).toBeTrue();
+        expect(o.afterPrototypeChange).toBe("x");
+        for (let i = 50; i < 100; ++i) expect(o["key" + i]).toBe(i);
+    });
+
+    test("object used as a prototype after deletes keeps values intact", () => {
+        let o = makeDictionary(100);
+        for (let i = 0; i < 100; i += 3) delete o["key" + i];
+
+        let child = Object.create(o);
+        for (let i = 0; i < 100; ++i) {
+            if (i % 3 === 0) expect(child["key" + i]).toBeUndefined();
+            else expect(child["key" + i]).toBe(i);
+        }
+    });
+});
@@ -5,6 +5,7 @@
  */
 
 #include <AK/Enumerate.h>
+#include <AK/ScopeGuard.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
@@ -499,6 +500,10 @@ Result AbstractMachine::invoke(Interpreter& interpreter, FunctionAddress address
     Configuration configuration { m_store };
     if (m_should_limit_instruction_count)
         configuration.enable_instruction_count_limit();
+    configuration.set_profiler(m_profiler);
+
+    ++m_active_invocation_count;
+    ScopeGuard decrement_active_invocation_count = [&] { --m_active_invocation_count; };
     return configuration.call(interpreter, address, move(arguments));
 }
 
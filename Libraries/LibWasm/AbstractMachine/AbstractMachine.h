@@ -20,6 +20,7 @@
 namespace Wasm {
 
 class Configuration;
+class Profiler;
 class Result;
 struct Interpreter;
 
@@ -644,12 +645,21 @@ public:
 
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
 
+    // The profiler is not owned by the machine. Every invocation keeps using the profiler that was set when it started,
+    // so a replaced profiler must stay alive until has_active_invocations() returns false.
+    void set_profiler(Profiler* profiler) { m_profiler = profiler; }
+    Profiler* profiler() const { return m_profiler; }
+
+    bool has_active_invocations() const { return m_active_invocation_count > 0; }
+
 private:
     Optional<InstantiationError> allocate_all_initial_phase(Module const&, ModuleInstance&, Vector<ExternValue>&, Vector<Value>& global_values, Vector<FunctionAddress>& own_functions);
     Optional<InstantiationError> allocate_all_final_phase(Module const&, ModuleInstance&, Vector<Vector<Reference>>& elements);
     Store m_store;
     StackInfo m_stack_info;
     bool m_should_limit_instruction_count { false };
+    Profiler* m_profiler { nullptr };
+    size_t m_active_invocation_count { 0 };
 };
 
 class Linker {
@@ -15,6 +15,7 @@
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Operators.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWasm/Opcode.h>
 #include <LibWasm/Printer/Printer.h>
 
@@ -37,6 +38,7 @@ void BytecodeInterpreter::interpret(Configuration& configuration)
     auto max_ip_value = InstructionPointer { instructions.size() };
     auto& current_ip_value = configuration.ip();
     auto const should_limit_instruction_count = configuration.should_limit_instruction_count();
+    auto* const profiler = configuration.profiler();
     u64 executed_instructions = 0;
 
     while (current_ip_value < max_ip_value) {
@@ -47,6 +49,8 @@ void BytecodeInterpreter::interpret(Configuration& configuration)
             }
         }
         auto& instruction = instructions[current_ip_value.value()];
+        if (profiler) [[unlikely]]
+            profiler->record_instruction(instruction.opcode());
         auto old_ip = current_ip_value;
         interpret_instruction(configuration, current_ip_value, instruction);
         if (did_trap())
@@ -637,7 +641,10 @@ ALWAYS_INLINE void BytecodeInterpreter::interpret_instruction(Configuration& con
         auto& entry = configuration.value_stack().last();
         auto new_pages = entry.to<i32>();
         dbgln_if(WASM_TRACE_DEBUG, "memory.grow({}), previously {} pages...", new_pages, old_pages);
-        if (instance->grow(new_pages * Constants::page_size))
+        auto succeeded = instance->grow(new_pages * Constants::page_size);
+        if (auto* profiler = configuration.profiler())
+            profiler->record_memory_grow(address, static_cast<u32>(old_pages), static_cast<u32>(new_pages), succeeded);
+        if (succeeded)
             entry = Value((i32)old_pages);
         else
             entry = Value((i32)-1);
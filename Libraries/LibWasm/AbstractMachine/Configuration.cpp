@@ -7,6 +7,7 @@
 #include <AK/MemoryStream.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Interpreter.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWasm/Printer/Printer.h>
 
 namespace Wasm {
@@ -23,6 +24,8 @@ Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Ve
     auto* function = m_store.get(address);
     if (!function)
         return Trap {};
+
+    Profiler::FunctionScope profiler_scope { m_profiler, address };
     if (auto* wasm_function = function->get_pointer<WasmFunction>()) {
         Vector<Value> locals = move(arguments);
         locals.ensure_capacity(locals.size() + wasm_function->code().func().locals().size());
@@ -61,6 +61,9 @@ public:
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
     bool should_limit_instruction_count() const { return m_should_limit_instruction_count; }
 
+    void set_profiler(Profiler* profiler) { m_profiler = profiler; }
+    ALWAYS_INLINE Profiler* profiler() const { return m_profiler; }
+
     void dump_stack();
 
 private:
@@ -71,6 +74,7 @@ private:
     size_t m_depth { 0 };
     InstructionPointer m_ip;
     bool m_should_limit_instruction_count { false };
+    Profiler* m_profiler { nullptr };
 };
 
 }
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/QuickSort.h>
+#include <AK/StringBuilder.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
+#include <LibWasm/Printer/Printer.h>
+
+namespace Wasm {
+
+size_t Profiler::call_tree_child(size_t parent, FunctionAddress function)
+{
+    if (auto child = m_call_tree[parent].children.get(function); child.has_value())
+        return *child;
+
+    auto index = m_call_tree.size();
+    m_call_tree.append({ .function = function, .parent = parent, .children = {}, .self_time = {} });
+    m_call_tree[parent].children.set(function, index);
+    return index;
+}
+
+void Profiler::enter_function(FunctionAddress address)
+{
+    auto now = MonotonicTime::now();
+    if (!m_start.has_value())
+        m_start = now;
+
+    // Node 0 is the (nameless) root of the call tree.
+    if (m_call_tree.is_empty())
+        m_call_tree.append({ .function = {}, .parent = {}, .children = {}, .self_time = {} });
+
+    auto parent_node = m_active_frames.is_empty() ? 0 : m_active_frames.last().call_tree_node;
+    auto node = call_tree_child(parent_node, address);
+
+    auto& statistics = m_functions.ensure(address);
+    ++statistics.call_count;
+    ++statistics.active_depth;
+
+    m_active_frames.append({ .function = address, .call_tree_node = node, .start = now, .child_time = {} });
+}
+
+void Profiler::exit_function()
+{
+    if (m_active_frames.is_empty())
+        return;
+
+    auto frame = m_active_frames.take_last();
+    auto total = MonotonicTime::now() - frame.start;
+    auto self = total - frame.child_time;
+
+    auto& statistics = m_functions.ensure(frame.function);
+    statistics.self_time += self;
+    // Only the outermost activation of a recursive function contributes to its total time.
+    if (--statistics.active_depth == 0)
+        statistics.total_time += total;
+
+    m_call_tree[frame.call_tree_node].self_time += self;
+
+    if (!m_active_frames.is_empty())
+        m_active_frames.last().child_time += total;
+}
+
+void Profiler::record_memory_grow(MemoryAddress memory, u32 old_pages, u32 delta_pages, bool succeeded)
+{
+    auto now = MonotonicTime::now();
+    if (!m_start.has_value())
+        m_start = now;
+
+    Optional<FunctionAddress> function;
+    if (!m_active_frames.is_empty())
+        function = m_active_frames.last().function;
+
+    m_memory_grow_events.append({
+        .memory = memory,
+        .function = function,
+        .old_pages = old_pages,
+        .delta_pages = delta_pages,
+        .succeeded = succeeded,
+        .time_since_start = now - *m_start,
+    });
+}
+
+void Profiler::reset()
+{
+    m_functions.clear();
+    m_opcode_counts.fill(0);
+    m_memory_grow_events.clear();
+    m_call_tree.clear();
+    m_active_frames.clear();
+    m_start.clear();
+}
+
+OpCode Profiler::opcode_for_slot(size_t slot)
+{
+    if (slot >= 512)
+        return 0xfd00000000000000ull | (slot - 512);
+    if (slot >= 256)
+        return 0xfc00000000000000ull | (slot - 256);
+    return slot;
+}
+
+ByteString Profiler::default_function_name(Store& store, FunctionAddress address)
+{
+    auto* function = store.get(address);
+    if (!function)
+        return ByteString::formatted("<unknown {}>", address.value());
+    return function->visit(
+        [&](WasmFunction const& wasm_function) {
+            auto index = wasm_function.module().functions().find_first_index(address);
+            return ByteString::formatted("func{}", index.value_or(address.value()));
+        },
+        [](HostFunction const& host_function) {
+            return host_function.name();
+        });
+}
+
+ErrorOr<void> Profiler::write_report(Stream& stream, FunctionNamer const& name_of) const
+{
+    StringBuilder builder;
+
+    Vector<FunctionAddress> functions;
+    TRY(functions.try_ensure_capacity(m_functions.size()));
+    for (auto const& entry : m_functions)
+        functions.unchecked_append(entry.key);
+    quick_sort(functions, [&](auto a, auto b) {
+        return m_functions.get(a)->self_time > m_functions.get(b)->self_time;
+    });
+
+    builder.appendff("{:>12} {:>14} {:>14}  {}\n", "calls", "self (us)", "total (us)", "function");
+    for (auto address : functions) {
+        auto const& statistics = *m_functions.get(address);
+        builder.appendff("{:>12} {:>14} {:>14}  {}\n",
+            statistics.call_count,
+            statistics.self_time.to_microseconds(),
+            statistics.total_time.to_microseconds(),
+            name_of(address));
+    }
+
+    Vector<size_t> opcode_slots;
+    u64 total_instructions = 0;
+    for (size_t slot = 0; slot < opcode_slot_count; ++slot) {
+        if (auto count = m_opcode_counts[slot]) {
+            TRY(opcode_slots.try_append(slot));
+            total_instructions += count;
+        }
+    }
+    if (!opcode_slots.is_empty()) {
+        quick_sort(opcode_slots, [&](auto a, auto b) {
+            return m_opcode_counts[a] > m_opcode_counts[b];
+        });
+
+        builder.appendff("\n{:>14} {:>7}  {}\n", "executed", "%", "opcode");
+        for (auto slot : opcode_slots) {
+            auto count = m_opcode_counts[slot];
+            builder.appendff("{:>14} {:>7.2}  {}\n", count, 100.0 * static_cast<double>(count) / static_cast<double>(total_instructions), instruction_name(opcode_for_slot(slot)));
+        }
+    }
+
+    if (!m_memory_grow_events.is_empty()) {
+        builder.append("\nmemory.grow events:\n"sv);
+        for (auto const& event : m_memory_grow_events) {
+            builder.appendff("  +{}us memory {}: {} -> {} pages{}, in {}\n",
+                event.time_since_start.to_microseconds(),
+                event.memory.value(),
+                event.old_pages,
+                event.old_pages + event.delta_pages,
+                event.succeeded ? ""sv : " (failed)"sv,
+                event.function.has_value() ? name_of(*event.function) : ByteString("<host>"sv));
+        }
+    }
+
+    return stream.write_until_depleted(builder.string_view().bytes());
+}
+
+ErrorOr<void> Profiler::write_folded_stacks(Stream& stream, FunctionNamer const& name_of) const
+{
+    StringBuilder builder;
+    Vector<ByteString> frames;
+
+    for (size_t index = 1; index < m_call_tree.size(); ++index) {
+        auto const& node = m_call_tree[index];
+        auto microseconds = node.self_time.to_microseconds();
+        if (microseconds <= 0)
+            continue;
+
+        frames.clear_with_capacity();
+        for (Optional<size_t> current = index; current.has_value() && *current != 0; current = m_call_tree[*current].parent)
+            frames.append(name_of(m_call_tree[*current].function));
+
+        for (size_t i = frames.size(); i > 0; --i) {
+            builder.append(frames[i - 1]);
+            if (i > 1)
+                builder.append(';');
+        }
+        builder.appendff(" {}\n", microseconds);
+    }
+
+    return stream.write_until_depleted(builder.string_view().bytes());
+}
+
+}
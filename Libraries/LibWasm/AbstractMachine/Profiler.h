@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/ByteString.h>
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/Stream.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+
+namespace Wasm {
+
+// Opt-in execution profiler; attach one to an AbstractMachine (or a Configuration) to collect per-function
+// call counts and timings, an opcode histogram and memory growth events.
+class Profiler {
+    AK_MAKE_NONCOPYABLE(Profiler);
+    AK_MAKE_NONMOVABLE(Profiler);
+
+public:
+    Profiler() = default;
+
+    struct FunctionStatistics {
+        u64 call_count { 0 };
+        Duration self_time;
+        Duration total_time;
+        u32 active_depth { 0 };
+    };
+
+    struct MemoryGrowEvent {
+        MemoryAddress memory;
+        Optional<FunctionAddress> function;
+        u32 old_pages { 0 };
+        u32 delta_pages { 0 };
+        bool succeeded { false };
+        Duration time_since_start;
+    };
+
+    class FunctionScope {
+        AK_MAKE_NONCOPYABLE(FunctionScope);
+        AK_MAKE_NONMOVABLE(FunctionScope);
+
+    public:
+        FunctionScope(Profiler* profiler, FunctionAddress address)
+            : m_profiler(profiler)
+        {
+            if (m_profiler) [[unlikely]]
+                m_profiler->enter_function(address);
+        }
+
+        ~FunctionScope()
+        {
+            if (m_profiler) [[unlikely]]
+                m_profiler->exit_function();
+        }
+
+    private:
+        Profiler* m_profiler { nullptr };
+    };
+
+    void enter_function(FunctionAddress);
+    void exit_function();
+    ALWAYS_INLINE void record_instruction(OpCode opcode) { ++m_opcode_counts[opcode_slot(opcode)]; }
+    void record_memory_grow(MemoryAddress, u32 old_pages, u32 delta_pages, bool succeeded);
+
+    void reset();
+
+    auto const& function_statistics() const { return m_functions; }
+    auto const& memory_grow_events() const { return m_memory_grow_events; }
+
+    using FunctionNamer = Function<ByteString(FunctionAddress)>;
+
+    // Fallback name for functions the embedder has no better name for: "func<index>" for wasm functions, the host
+    // function's own name otherwise.
+    static ByteString default_function_name(Store&, FunctionAddress);
+
+    // Human-readable report: functions sorted by self time, then the opcode histogram and memory growth events.
+    ErrorOr<void> write_report(Stream&, FunctionNamer const&) const;
+    // One line per unique call stack with its self time in microseconds, as consumed by flamegraph.pl and friends.
+    ErrorOr<void> write_folded_stacks(Stream&, FunctionNamer const&) const;
+
+private:
+    // Opcodes are either a single byte, or a 0xfc or 0xfd prefix followed by a sub-opcode below 256, so every opcode
+    // gets a slot in a flat array of counters.
+    static constexpr size_t opcode_slot_count = 3 * 256;
+    static constexpr size_t opcode_slot(OpCode opcode)
+    {
+        auto value = opcode.value();
+        switch (value >> 56) {
+        case 0xfc:
+            return 256 + (value & 0xff);
+        case 0xfd:
+            return 512 + (value & 0xff);
+        default:
+            return value & 0xff;
+        }
+    }
+    static OpCode opcode_for_slot(size_t slot);
+
+    struct CallTreeNode {
+        FunctionAddress function;
+        Optional<size_t> parent;
+        HashMap<FunctionAddress, size_t> children;
+        Duration self_time;
+    };
+
+    struct ActiveFrame {
+        FunctionAddress function;
+        size_t call_tree_node { 0 };
+        MonotonicTime start;
+        Duration child_time;
+    };
+
+    size_t call_tree_child(size_t parent, FunctionAddress);
+
+    HashMap<FunctionAddress, FunctionStatistics> m_functions;
+    Array<u64, opcode_slot_count> m_opcode_counts {};
+    Vector<MemoryGrowEvent> m_memory_grow_events;
+    Vector<CallTreeNode> m_call_tree;
+    Vector<ActiveFrame> m_active_frames;
+    Optional<MonotonicTime> m_start;
+};
+
+}
@@ -943,24 +943,34 @@ void KeyframeEffect::update_computed_properties()
         auto element_invalidation = element.recompute_inherited_style();
         if (element_invalidation.is_none())
             return TraversalDecision::SkipChildrenAndContinue;
+        if (element_invalidation.rebuild_layout_tree)
+            element.invalidate_layout_tree_for_style_change();
         invalidation |= element_invalidation;
         return TraversalDecision::Continue;
     });
 
+    GC::Ptr<Layout::NodeWithStyle> animated_layout_node;
     if (!pseudo_element_type().has_value()) {
-        if (target->layout_node())
+        if (target->layout_node()) {
             target->layout_node()->apply_style(*style);
+            animated_layout_node = target->layout_node();
+        }
     } else {
         auto pseudo_element_node = target->get_pseudo_element_node(pseudo_element_type().value());
         if (auto* node_with_style = dynamic_cast<Layout::NodeWithStyle*>(pseudo_element_node.ptr())) {
             node_with_style->apply_style(*style);
+            animated_layout_node = node_with_style;
         }
     }
 
-    if (invalidation.relayout)
-        document.set_needs_layout();
+    if (invalidation.relayout) {
+        if (animated_layout_node)
+            animated_layout_node->invalidate_layout(DOM::SetNeedsLayoutReason::KeyframeEffect);
+        else
+            document.set_needs_layout(DOM::SetNeedsLayoutReason::KeyframeEffect);
+    }
     if (invalidation.rebuild_layout_tree)
-        document.invalidate_layout_tree();
+        target->invalidate_layout_tree_for_style_change();
     if (invalidation.repaint) {
         document.set_needs_display();
         document.set_needs_to_resolve_paint_only_properties();
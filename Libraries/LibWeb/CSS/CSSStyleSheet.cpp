@@ -157,7 +157,17 @@ WebIDL::ExceptionOr<unsigned> CSSStyleSheet::insert_rule(StringView rule, unsign
         // NOTE: The spec doesn't say where to set the parent style sheet, so we'll do it here.
         parsed_rule->set_parent_style_sheet(this);
 
-        invalidate_owners(DOM::StyleInvalidationReason::StyleSheetInsertRule);
+        // NOTE: A sheet can be adopted by a document and its shadow roots, but each document's rule cache only needs to
+        //       be updated once.
+        Vector<GC::Ref<DOM::Document>, 1> updated_documents;
+        for (auto& document_or_shadow_root : m_owning_documents_or_shadow_roots) {
+            document_or_shadow_root->invalidate_style(DOM::StyleInvalidationReason::StyleSheetInsertRule);
+            auto& document = document_or_shadow_root->document();
+            if (updated_documents.contains_slow(document))
+                continue;
+            updated_documents.append(document);
+            document.style_computer().did_insert_rule_into_style_sheet(*this, *parsed_rule);
+        }
     }
 
     return result;
@@ -173,9 +183,13 @@ WebIDL::ExceptionOr<void> CSSStyleSheet::delete_rule(unsigned index)
         return WebIDL::NotAllowedError::create(realm(), "Can't call delete_rule() on non-modifiable stylesheets."_string);
 
     // 3. Remove a CSS rule in the CSS rules at index.
+    GC::Ptr<CSSRule> removed_rule = m_rules->item(index);
     auto result = m_rules->remove_a_css_rule(index);
     if (!result.is_exception()) {
-        invalidate_owners(DOM::StyleInvalidationReason::StyleSheetDeleteRule);
+        for (auto& document_or_shadow_root : m_owning_documents_or_shadow_roots) {
+            document_or_shadow_root->invalidate_style(DOM::StyleInvalidationReason::StyleSheetDeleteRule);
+            document_or_shadow_root->document().style_computer().did_remove_rule_from_style_sheet(*removed_rule);
+        }
     }
     return result;
 }
@@ -9,10 +9,10 @@
 
 #pragma once
 
+#include <AK/AtomicRefCounted.h>
 #include <AK/Concepts.h>
 #include <AK/GenericShorthands.h>
 #include <AK/NonnullOwnPtr.h>
-#include <AK/RefCounted.h>
 #include <AK/RefPtr.h>
 #include <AK/String.h>
 #include <AK/StringView.h>
@@ -84,7 +84,9 @@ private:
 using StyleValueVector = Vector<ValueComparingNonnullRefPtr<CSSStyleValue const>>;
 
 // https://drafts.css-houdini.org/css-typed-om-1/#cssstylevalue
-class CSSStyleValue : public RefCounted<CSSStyleValue> {
+// NOTE: Style values are shared between elements, and end up in the computed values that layout threads copy
+//       (for example, every calc() in a LengthPercentage), so their reference count has to be atomic.
+class CSSStyleValue : public AtomicRefCounted<CSSStyleValue> {
 public:
     virtual ~CSSStyleValue() = default;
 
@@ -367,7 +369,8 @@ public:
 
     bool operator==(CSSStyleValue const& other) const
     {
-        return this->equals(other);
+        // NOTE: Common values are shared, so this often avoids a virtual call.
+        return this == &other || this->equals(other);
     }
 
 protected:
@@ -43,6 +43,67 @@ namespace Web::CSS {
 
 GC_DEFINE_ALLOCATOR(ComputedProperties);
 
+namespace {
+
+struct PropertyGroupLayout {
+    struct Location {
+        ComputedProperties::PropertyGroup group;
+        u16 index_in_group;
+    };
+    Array<Location, ComputedProperties::number_of_properties> locations;
+    Array<size_t, ComputedProperties::number_of_property_groups> group_sizes {};
+};
+
+}
+
+static ComputedProperties::PropertyGroup classify_property(PropertyID property_id)
+{
+    using PropertyGroup = ComputedProperties::PropertyGroup;
+
+    if (is_inherited_property(property_id))
+        return PropertyGroup::InheritedText;
+
+    auto name = string_from_property_id(property_id).bytes_as_string_view();
+    auto starts_with_any_of = [&](ReadonlySpan<StringView> prefixes) {
+        for (auto prefix : prefixes) {
+            if (name.starts_with(prefix))
+                return true;
+        }
+        return false;
+    };
+
+    if (starts_with_any_of({ "background"sv }))
+        return PropertyGroup::Background;
+    if (starts_with_any_of({ "animation"sv, "transition"sv }))
+        return PropertyGroup::Animation;
+    if (starts_with_any_of({ "flex"sv, "grid"sv, "align-"sv, "justify-"sv, "place-"sv, "order"sv, "gap"sv, "row-gap"sv, "column-gap"sv }))
+        return PropertyGroup::FlexAndGrid;
+    if (starts_with_any_of({ "margin"sv, "padding"sv, "border"sv, "outline"sv, "width"sv, "height"sv, "min-"sv, "max-"sv,
+            "inset"sv, "top"sv, "right"sv, "bottom"sv, "left"sv, "box-sizing"sv, "display"sv, "position"sv, "float"sv,
+            "clear"sv, "overflow"sv }))
+        return PropertyGroup::BoxModel;
+    return PropertyGroup::Rare;
+}
+
+static PropertyGroupLayout const& property_group_layout()
+{
+    static PropertyGroupLayout const layout = [] {
+        PropertyGroupLayout layout;
+        for (size_t i = 0; i < ComputedProperties::number_of_properties; ++i) {
+            auto group = classify_property(static_cast<PropertyID>(i));
+            auto& group_size = layout.group_sizes[to_underlying(group)];
+            layout.locations[i] = { group, static_cast<u16>(group_size++) };
+        }
+        return layout;
+    }();
+    return layout;
+}
+
+ComputedProperties::PropertyGroup ComputedProperties::group_for_property(PropertyID property_id)
+{
+    return property_group_layout().locations[to_underlying(property_id)].group;
+}
+
 ComputedProperties::ComputedProperties() = default;
 
 ComputedProperties::~ComputedProperties() = default;
@@ -54,6 +115,97 @@ void ComputedProperties::visit_edges(Visitor& visitor)
     visitor.visit(m_transition_property_source);
 }
 
+GC::Ref<ComputedProperties> ComputedProperties::clone() const
+{
+    auto clone = heap().allocate<ComputedProperties>();
+    clone->m_animation_name_source = m_animation_name_source;
+    clone->m_transition_property_source = m_transition_property_source;
+    clone->m_property_groups = m_property_groups;
+    clone->m_property_important = m_property_important;
+    clone->m_property_inherited = m_property_inherited;
+    clone->m_math_depth = m_math_depth;
+    clone->m_font_list = m_font_list;
+    clone->m_line_height = m_line_height;
+    clone->m_did_match_any_hover_rules = m_did_match_any_hover_rules;
+    clone->m_is_shareable_with_siblings = m_is_shareable_with_siblings;
+    return clone;
+}
+
+RefPtr<CSSStyleValue const> const& ComputedProperties::value_slot(PropertyID property_id) const
+{
+    static RefPtr<CSSStyleValue const> const empty_slot;
+    auto location = property_group_layout().locations[to_underlying(property_id)];
+    auto const& group = m_property_groups[to_underlying(location.group)];
+    if (!group)
+        return empty_slot;
+    return group->values[location.index_in_group];
+}
+
+RefPtr<CSSStyleValue const>& ComputedProperties::mutable_value_slot(PropertyID property_id)
+{
+    auto const& layout = property_group_layout();
+    auto location = layout.locations[to_underlying(property_id)];
+    auto& group = m_property_groups[to_underlying(location.group)];
+    if (!group) {
+        group = adopt_ref(*new PropertyGroupValues(layout.group_sizes[to_underlying(location.group)]));
+    } else if (group->ref_count() > 1) {
+        // Someone else shares this group, so make our own copy before writing to it.
+        auto copy = adopt_ref(*new PropertyGroupValues(0));
+        copy->values = group->values;
+        group = move(copy);
+    }
+    return group->values[location.index_in_group];
+}
+
+void ComputedProperties::share_identical_property_groups_with(ComputedProperties const* parent, ComputedProperties const* previous_sibling)
+{
+    for (size_t i = 0; i < number_of_property_groups; ++i) {
+        auto const* other = parent;
+        if (previous_sibling && static_cast<PropertyGroup>(i) != PropertyGroup::InheritedText)
+            other = previous_sibling;
+        if (!other)
+            continue;
+
+        auto& group = m_property_groups[i];
+        auto const& other_group = other->m_property_groups[i];
+        if (!group || !other_group || group == other_group)
+            continue;
+
+        bool identical = true;
+        for (size_t j = 0; identical && j < group->values.size(); ++j) {
+            auto const& value = group->values[j];
+            auto const& other_value = other_group->values[j];
+            if (value == other_value)
+                continue;
+            identical = value && other_value && *value == *other_value;
+        }
+        if (identical)
+            group = other_group;
+    }
+}
+
+void ComputedProperties::collect_memory_statistics(MemoryStatistics& statistics) const
+{
+    auto const& layout = property_group_layout();
+
+    ++statistics.computed_properties_count;
+    statistics.bytes_used += sizeof(ComputedProperties);
+    statistics.bytes_used_without_sharing += sizeof(ComputedProperties);
+
+    for (size_t i = 0; i < number_of_property_groups; ++i) {
+        auto const& group = m_property_groups[i];
+        if (!group)
+            continue;
+        auto group_bytes = sizeof(PropertyGroupValues) + layout.group_sizes[i] * sizeof(RefPtr<CSSStyleValue const>);
+        ++statistics.property_group_references;
+        statistics.bytes_used_without_sharing += group_bytes;
+        if (statistics.seen_property_groups.set(group.ptr()) == HashSetResult::InsertedNewEntry) {
+            ++statistics.unique_property_groups;
+            statistics.bytes_used += group_bytes;
+        }
+    }
+}
+
 bool ComputedProperties::is_property_important(PropertyID property_id) const
 {
     size_t n = to_underlying(property_id);
@@ -86,14 +238,14 @@ void ComputedProperties::set_property_inherited(PropertyID property_id, Inherite
 
 void ComputedProperties::set_property(PropertyID id, NonnullRefPtr<CSSStyleValue const> value, Inherited inherited, Important important)
 {
-    m_property_values[to_underlying(id)] = move(value);
+    mutable_value_slot(id) = move(value);
     set_property_important(id, important);
     set_property_inherited(id, inherited);
 }
 
 void ComputedProperties::revert_property(PropertyID id, ComputedProperties const& style_for_revert)
 {
-    m_property_values[to_underlying(id)] = style_for_revert.m_property_values[to_underlying(id)];
+    mutable_value_slot(id) = style_for_revert.value_slot(id);
     set_property_important(id, style_for_revert.is_property_important(id) ? Important::Yes : Important::No);
     set_property_inherited(id, style_for_revert.is_property_inherited(id) ? Inherited::Yes : Inherited::No);
 }
@@ -116,14 +268,14 @@ CSSStyleValue const& ComputedProperties::property(PropertyID property_id, WithAn
     }
 
     // By the time we call this method, all properties have values assigned.
-    return *m_property_values[to_underlying(property_id)];
+    return *value_slot(property_id);
 }
 
 CSSStyleValue const* ComputedProperties::maybe_null_property(PropertyID property_id) const
 {
     if (auto animated_value = m_animated_property_values.get(property_id); animated_value.has_value())
         return animated_value.value();
-    return m_property_values[to_underlying(property_id)];
+    return value_slot(property_id);
 }
 
 Variant<LengthPercentage, NormalGap> ComputedProperties::gap_value(PropertyID id) const
@@ -695,12 +847,9 @@ Positioning ComputedProperties::position() const
 
 bool ComputedProperties::operator==(ComputedProperties const& other) const
 {
-    if (m_property_values.size() != other.m_property_values.size())
-        return false;
-
-    for (size_t i = 0; i < m_property_values.size(); ++i) {
-        auto const& my_style = m_property_values[i];
-        auto const& other_style = other.m_property_values[i];
+    for (size_t i = 0; i < number_of_properties; ++i) {
+        auto const& my_style = value_slot(static_cast<PropertyID>(i));
+        auto const& other_style = other.value_slot(static_cast<PropertyID>(i));
         if (!my_style) {
             if (other_style)
                 return false;
@@ -9,6 +9,7 @@
 
 #include <AK/HashMap.h>
 #include <AK/NonnullRefPtr.h>
+#include <AK/RefCounted.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Ptr.h>
 #include <LibGfx/Font/Font.h>
@@ -29,14 +30,30 @@ class ComputedProperties final : public JS::Cell {
 public:
     static constexpr size_t number_of_properties = to_underlying(last_property_id) + 1;
 
+    // Property values are stored in groups of related properties, loosely modeled on Gecko's style structs.
+    // Groups are reference counted and copied on write, so elements whose values for a whole group are
+    // identical (typically a parent and its children for inherited text properties, or siblings) share them.
+    enum class PropertyGroup : u8 {
+        InheritedText,
+        BoxModel,
+        Background,
+        FlexAndGrid,
+        Animation,
+        Rare,
+        __Count,
+    };
+    static constexpr size_t number_of_property_groups = to_underlying(PropertyGroup::__Count);
+
+    static PropertyGroup group_for_property(PropertyID);
+
     virtual ~ComputedProperties() override;
 
     template<typename Callback>
     inline void for_each_property(Callback callback) const
     {
-        for (size_t i = 0; i < m_property_values.size(); ++i) {
-            if (m_property_values[i])
-                callback((PropertyID)i, *m_property_values[i]);
+        for (size_t i = 0; i < number_of_properties; ++i) {
+            if (auto const& value = value_slot(static_cast<PropertyID>(i)))
+                callback(static_cast<PropertyID>(i), *value);
         }
     }
 
@@ -222,6 +239,27 @@ public:
     bool did_match_any_hover_rules() const { return m_did_match_any_hover_rules; }
     void set_did_match_any_hover_rules() { m_did_match_any_hover_rules = true; }
 
+    bool is_shareable_with_siblings() const { return m_is_shareable_with_siblings; }
+    void set_is_shareable_with_siblings() { m_is_shareable_with_siblings = true; }
+
+    // Returns a copy of the computed (non-animated) values, for handing out to an element that shares this style.
+    [[nodiscard]] GC::Ref<ComputedProperties> clone() const;
+
+    // Makes this style reuse property groups that hold exactly the same values as another style's. Each group is only
+    // compared against one candidate: inherited groups against the parent, the rest against the previous sibling (or
+    // the parent, if there is no previous sibling).
+    void share_identical_property_groups_with(ComputedProperties const* parent, ComputedProperties const* previous_sibling);
+
+    struct MemoryStatistics {
+        size_t computed_properties_count { 0 };
+        size_t property_group_references { 0 };
+        size_t unique_property_groups { 0 };
+        size_t bytes_used { 0 };
+        size_t bytes_used_without_sharing { 0 };
+        HashTable<void const*> seen_property_groups;
+    };
+    void collect_memory_statistics(MemoryStatistics&) const;
+
 private:
     friend class StyleComputer;
 
@@ -232,10 +270,18 @@ private:
     Overflow overflow(PropertyID) const;
     Vector<ShadowData> shadow(PropertyID, Layout::Node const&) const;
 
+    struct PropertyGroupValues : public RefCounted<PropertyGroupValues> {
+        explicit PropertyGroupValues(size_t size) { values.resize(size); }
+        Vector<RefPtr<CSSStyleValue const>> values;
+    };
+
+    RefPtr<CSSStyleValue const> const& value_slot(PropertyID) const;
+    RefPtr<CSSStyleValue const>& mutable_value_slot(PropertyID);
+
     GC::Ptr<CSSStyleDeclaration const> m_animation_name_source;
     GC::Ptr<CSSStyleDeclaration const> m_transition_property_source;
 
-    Array<RefPtr<CSSStyleValue const>, number_of_properties> m_property_values;
+    Array<RefPtr<PropertyGroupValues>, number_of_property_groups> m_property_groups;
     Array<u8, ceil_div(number_of_properties, 8uz)> m_property_important {};
     Array<u8, ceil_div(number_of_properties, 8uz)> m_property_inherited {};
 
@@ -247,6 +293,7 @@ private:
     Optional<CSSPixels> m_line_height;
 
     bool m_did_match_any_hover_rules { false };
+    bool m_is_shareable_with_siblings { false };
 };
 
 }
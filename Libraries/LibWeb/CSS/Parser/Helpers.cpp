@@ -24,9 +24,9 @@ CSS::CSSStyleSheet* parse_css_stylesheet(CSS::Parser::ParsingParams const& conte
         style_sheet->set_source_text({});
         return style_sheet;
     }
-    auto* style_sheet = CSS::Parser::Parser::create(context, css).parse_as_css_stylesheet(location);
-    // FIXME: Avoid this copy
-    style_sheet->set_source_text(MUST(String::from_utf8(css)));
+    auto source_text = MUST(String::from_utf8(css));
+    auto* style_sheet = CSS::Parser::Parser::create_for_style_sheet(context, source_text).parse_as_css_stylesheet(location);
+    style_sheet->set_source_text(move(source_text));
     return style_sheet;
 }
 
@@ -71,6 +71,68 @@ Parser Parser::create(ParsingParams const& context, StringView input, StringView
     return Parser { context, move(tokens) };
 }
 
+// Style sheets shorter than this are cheaper to parse again than to look up.
+static constexpr size_t minimum_style_sheet_length_for_shared_rules = 1024;
+static constexpr size_t max_shared_style_sheet_rules_bytes = 16 * MiB;
+
+struct SharedStyleSheetRulesEntry {
+    String source_text;
+    NonnullRefPtr<SharedStyleSheetRules const> rules;
+    size_t estimated_bytes { 0 };
+};
+
+struct SharedStyleSheetRulesCache {
+    // NOTE: Keyed by a hash of the source text, least recently used first.
+    OrderedHashMap<u32, SharedStyleSheetRulesEntry> entries;
+    size_t estimated_bytes { 0 };
+};
+
+// NOTE: Style sheets from a CDN are often loaded by many documents (and iframes) in the same process.
+static SharedStyleSheetRulesCache& shared_style_sheet_rules()
+{
+    static SharedStyleSheetRulesCache cache;
+    return cache;
+}
+
+Parser Parser::create_for_style_sheet(ParsingParams const& context, String const& source_text)
+{
+    if (source_text.bytes().size() < minimum_style_sheet_length_for_shared_rules)
+        return create(context, source_text.bytes_as_string_view());
+
+    auto& cache = shared_style_sheet_rules();
+    auto key = source_text.hash();
+    if (auto it = cache.entries.find(key); it != cache.entries.end()) {
+        auto entry = move(it->value);
+        cache.entries.remove(it);
+        if (entry.source_text == source_text) {
+            auto rules = entry.rules;
+            cache.entries.set(key, move(entry));
+            return Parser { context, move(rules) };
+        }
+        cache.estimated_bytes -= entry.estimated_bytes;
+    }
+
+    // Consuming a style sheet's contents only depends on the tokens, so the resulting rules can be shared by every
+    // document that parses the same text. Each of them still converts the rules into its own CSSOM.
+    auto tokens = Tokenizer::tokenize(source_text.bytes_as_string_view(), "utf-8"sv);
+    auto estimated_bytes = source_text.bytes().size() + tokens.size() * sizeof(ComponentValue);
+    Parser tokenizing_parser { context, move(tokens) };
+    auto rules = adopt_ref(*new SharedStyleSheetRules(tokenizing_parser.parse_a_stylesheet(tokenizing_parser.m_token_stream, {}).rules));
+
+    if (estimated_bytes <= max_shared_style_sheet_rules_bytes) {
+        while (cache.estimated_bytes + estimated_bytes > max_shared_style_sheet_rules_bytes) {
+            auto oldest = cache.entries.begin();
+            cache.estimated_bytes -= oldest->value.estimated_bytes;
+            cache.entries.remove(oldest);
+        }
+        // NOTE: String is reference counted, so this shares the text with the style sheet instead of copying it.
+        cache.entries.set(key, { source_text, rules, estimated_bytes });
+        cache.estimated_bytes += estimated_bytes;
+    }
+
+    return Parser { context, move(rules) };
+}
+
 Parser::Parser(ParsingParams const& context, Vector<Token> tokens)
     : m_document(context.document)
     , m_realm(context.realm)
@@ -81,6 +143,16 @@ Parser::Parser(ParsingParams const& context, Vector<Token> tokens)
 {
 }
 
+Parser::Parser(ParsingParams const& context, NonnullRefPtr<SharedStyleSheetRules const> rules)
+    : m_document(context.document)
+    , m_realm(context.realm)
+    , m_url(context.url)
+    , m_parsing_mode(context.mode)
+    , m_token_stream(m_tokens)
+    , m_shared_style_sheet_rules(move(rules))
+{
+}
+
 // https://drafts.csswg.org/css-syntax/#parse-stylesheet
 template<typename T>
 Parser::ParsedStyleSheet Parser::parse_a_stylesheet(TokenStream<T>& input, Optional<URL::URL> location)
@@ -119,11 +191,15 @@ Vector<Rule> Parser::parse_a_stylesheets_contents(TokenStream<T>& input)
 CSSStyleSheet* Parser::parse_as_css_stylesheet(Optional<URL::URL> location)
 {
     // To parse a CSS stylesheet, first parse a stylesheet.
-    auto const& style_sheet = parse_a_stylesheet(m_token_stream, {});
+    // NOTE: If we were created for a style sheet whose rules have been parsed before, reuse those.
+    ParsedStyleSheet style_sheet;
+    if (!m_shared_style_sheet_rules)
+        style_sheet = parse_a_stylesheet(m_token_stream, {});
+    auto const& raw_rules = m_shared_style_sheet_rules ? m_shared_style_sheet_rules->rules : style_sheet.rules;
 
     // Interpret all of the resulting top-level qualified rules as style rules, defined below.
     GC::RootVector<CSSRule*> rules(realm().heap());
-    for (auto const& raw_rule : style_sheet.rules) {
+    for (auto const& raw_rule : raw_rules) {
         auto rule = convert_to_rule(raw_rule, Nested::No);
         // If any style rule is invalid, or any at-rule is not recognized or is invalid according to its grammar or context, it’s a parse error.
         // Discard that rule.
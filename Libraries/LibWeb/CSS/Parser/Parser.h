@@ -77,6 +77,17 @@ struct ParsingParams {
     ParsingMode mode { ParsingMode::Normal };
 };
 
+// The syntax-level rules of a style sheet, shared between every Parser that parses identical source text.
+// They are immutable once created, so each document still builds its own CSSOM from them.
+struct SharedStyleSheetRules : public RefCounted<SharedStyleSheetRules> {
+    explicit SharedStyleSheetRules(Vector<Rule> rules)
+        : rules(move(rules))
+    {
+    }
+
+    Vector<Rule> const rules;
+};
+
 // The very large CSS Parser implementation code is broken up among several .cpp files:
 // Parser.cpp contains the core parser algorithms, defined in https://drafts.csswg.org/css-syntax
 // Everything else is in different *Parsing.cpp files
@@ -86,6 +97,8 @@ class Parser {
 
 public:
     static Parser create(ParsingParams const&, StringView input, StringView encoding = "utf-8"sv);
+    // Like create(), but reuses the rules of a recently parsed style sheet with the same source text.
+    static Parser create_for_style_sheet(ParsingParams const&, String const& source_text);
 
     CSSStyleSheet* parse_as_css_stylesheet(Optional<URL::URL> location);
     ElementInlineCSSStyleDeclaration* parse_as_style_attribute(DOM::Element&);
@@ -124,6 +137,7 @@ public:
 
 private:
     Parser(ParsingParams const&, Vector<Token>);
+    Parser(ParsingParams const&, NonnullRefPtr<SharedStyleSheetRules const>);
 
     enum class ParseError {
         IncludesIgnoredVendorPrefix,
@@ -469,6 +483,7 @@ private:
 
     Vector<Token> m_tokens;
     TokenStream<Token> m_token_stream;
+    RefPtr<SharedStyleSheetRules const> m_shared_style_sheet_rules;
 
     struct FunctionContext {
         StringView name;
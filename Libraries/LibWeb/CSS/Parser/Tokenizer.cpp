@@ -164,10 +164,16 @@ Vector<Token> Tokenizer::tokenize(StringView input, StringView encoding)
 
         auto decoded_input = MUST(decoder->to_utf8(input));
 
-        // OPTIMIZATION: If the input doesn't contain any filterable characters, we can skip the filtering
+        // OPTIMIZATION: If the input doesn't contain any filterable characters, we can skip the filtering.
+        //               Filterable code points are either ASCII or surrogates (0xED followed by 0xA0-0xBF in UTF-8),
+        //               so we can look for them without decoding the input.
         bool const contains_filterable = [&] {
-            for (auto code_point : decoded_input.code_points()) {
-                if (code_point == '\r' || code_point == '\f' || code_point == 0x00 || is_unicode_surrogate(code_point))
+            auto bytes = decoded_input.bytes();
+            for (size_t i = 0; i < bytes.size(); ++i) {
+                auto byte = bytes[i];
+                if (byte == '\r' || byte == '\f' || byte == 0x00)
+                    return true;
+                if (byte == 0xED && i + 1 < bytes.size() && bytes[i + 1] >= 0xA0)
                     return true;
             }
             return false;
@@ -261,6 +267,35 @@ u32 Tokenizer::next_code_point()
     return code_point;
 }
 
+// OPTIMIZATION: Most style sheets are mostly ASCII, so this consumes runs of ASCII code points that satisfy the
+//               predicate by looking at the bytes directly, instead of decoding one code point at a time.
+//               Returns the consumed run, which is empty if the next code point doesn't match.
+template<typename Predicate>
+StringView Tokenizer::consume_ascii_code_points_while(Predicate predicate)
+{
+    auto const* start = m_utf8_iterator.ptr();
+    auto const* end = m_utf8_view.bytes() + m_utf8_view.byte_length();
+    auto const* run_end = start;
+    while (run_end < end && is_ascii(*run_end) && predicate(*run_end)) {
+        m_prev_position = m_position;
+        if (is_newline(*run_end)) {
+            m_position.line++;
+            m_position.column = 0;
+        } else {
+            m_position.column++;
+        }
+        ++run_end;
+    }
+    if (run_end == start)
+        return {};
+
+    auto start_offset = m_utf8_view.byte_offset_of(m_utf8_iterator);
+    auto length = static_cast<size_t>(run_end - start);
+    m_prev_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(start_offset + length - 1);
+    m_utf8_iterator = m_utf8_view.iterator_at_byte_offset_without_validation(start_offset + length);
+    return { start, length };
+}
+
 u32 Tokenizer::peek_code_point(size_t offset) const
 {
     auto it = m_utf8_iterator;
@@ -571,6 +606,8 @@ FlyString Tokenizer::consume_an_ident_sequence()
 
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
+        result.append(consume_ascii_code_points_while(is_ident_code_point));
+
         auto input = next_code_point();
 
         if (is_eof(input))
@@ -740,9 +777,8 @@ void Tokenizer::consume_the_remnants_of_a_bad_url()
 
 void Tokenizer::consume_as_much_whitespace_as_possible()
 {
-    while (is_whitespace(peek_code_point())) {
-        (void)next_code_point();
-    }
+    // NOTE: All whitespace code points are ASCII.
+    (void)consume_ascii_code_points_while(is_whitespace);
 }
 
 void Tokenizer::reconsume_current_input_code_point()
@@ -931,6 +967,11 @@ Token Tokenizer::consume_string_token(u32 ending_code_point)
 
     // Repeatedly consume the next input code point from the stream:
     for (;;) {
+        // Code points that aren't handled specially below are appended as-is.
+        builder.append(consume_ascii_code_points_while([&](u32 code_point) {
+            return code_point != ending_code_point && !is_newline(code_point) && !is_reverse_solidus(code_point);
+        }));
+
         auto input = next_code_point();
 
         // ending code point
@@ -1002,6 +1043,8 @@ start:
     (void)next_code_point();
 
     for (;;) {
+        (void)consume_ascii_code_points_while([](u32 code_point) { return !is_asterisk(code_point); });
+
         auto twin_inner = peek_twin();
         if (is_eof(twin_inner.first) || is_eof(twin_inner.second)) {
             log_parse_error();
@@ -72,6 +72,8 @@ private:
     String input_since(size_t offset) const;
 
     [[nodiscard]] u32 next_code_point();
+    template<typename Predicate>
+    StringView consume_ascii_code_points_while(Predicate);
     [[nodiscard]] u32 peek_code_point(size_t offset = 0) const;
     [[nodiscard]] U32Twin peek_twin() const;
     [[nodiscard]] U32Triplet peek_triplet() const;
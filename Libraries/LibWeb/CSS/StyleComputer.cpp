@@ -7,6 +7,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AnyOf.h>
 #include <AK/BinarySearch.h>
 #include <AK/Debug.h>
 #include <AK/Error.h>
@@ -71,6 +72,7 @@
 #include <LibWeb/DOM/Attr.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/NamedNodeMap.h>
 #include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/HTML/HTMLBRElement.h>
 #include <LibWeb/HTML/HTMLHtmlElement.h>
@@ -444,6 +446,54 @@ InvalidationSet StyleComputer::invalidation_set_for_properties(Vector<Invalidati
     return result;
 }
 
+bool StyleComputer::may_affect_has_selectors_when_inserted_or_removed(DOM::Node const& node) const
+{
+    if (!has_valid_rule_cache() || !m_style_invalidation_data)
+        return true;
+    auto const& style_invalidation_data = *m_style_invalidation_data;
+    if (style_invalidation_data.has_selectors_affected_by_any_insertion_or_removal)
+        return true;
+
+    // NOTE: Class selectors are matched case insensitively in quirks mode, so compare class names the same way here.
+    bool in_quirks_mode = node.document().in_quirks_mode();
+    auto class_name_is_used_in_has_selectors = [&](FlyString const& class_name) {
+        if (!in_quirks_mode)
+            return style_invalidation_data.class_names_used_in_has_selectors.contains(class_name);
+        return any_of(style_invalidation_data.class_names_used_in_has_selectors, [&](FlyString const& used_class_name) {
+            return used_class_name.equals_ignoring_ascii_case(class_name);
+        });
+    };
+
+    auto element_is_mentioned_in_has_selectors = [&](DOM::Element const& element) {
+        if (element.id().has_value() && style_invalidation_data.ids_used_in_has_selectors.contains(*element.id()))
+            return true;
+        for (auto const& class_name : element.class_names()) {
+            if (class_name_is_used_in_has_selectors(class_name))
+                return true;
+        }
+        // NOTE: Tag and attribute names are collected lowercased, so only compare them directly for HTML elements.
+        if (element.namespace_uri() != Namespace::HTML)
+            return !style_invalidation_data.tag_names_used_in_has_selectors.is_empty() || !style_invalidation_data.attribute_names_used_in_has_selectors.is_empty();
+        if (style_invalidation_data.tag_names_used_in_has_selectors.contains(element.local_name()))
+            return true;
+        bool has_mentioned_attribute = false;
+        element.for_each_attribute([&](auto const& name, auto const&) {
+            if (style_invalidation_data.attribute_names_used_in_has_selectors.contains(name))
+                has_mentioned_attribute = true;
+        });
+        return has_mentioned_attribute;
+    };
+
+    bool may_affect = false;
+    node.for_each_in_inclusive_subtree_of_type<DOM::Element>([&](auto const& element) {
+        if (!element_is_mentioned_in_has_selectors(element))
+            return TraversalDecision::Continue;
+        may_affect = true;
+        return TraversalDecision::Break;
+    });
+    return may_affect;
+}
+
 bool StyleComputer::invalidation_property_used_in_has_selector(InvalidationSet::Property const& property) const
 {
     if (!m_style_invalidation_data)
@@ -475,7 +525,7 @@ bool StyleComputer::invalidation_property_used_in_has_selector(InvalidationSet::
     return false;
 }
 
-Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::Element const& element, CascadeOrigin cascade_origin, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, bool& did_match_any_hover_rules, FlyString const& qualified_layer_name) const
+Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::Element const& element, CascadeOrigin cascade_origin, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, bool& did_match_any_hover_rules, bool& did_run_any_rules_preventing_style_sharing, FlyString const& qualified_layer_name) const
 {
     auto const& root_node = element.root();
     auto shadow_root = is<DOM::ShadowRoot>(root_node) ? static_cast<DOM::ShadowRoot const*>(&root_node) : nullptr;
@@ -511,6 +561,9 @@ Vector<MatchingRule const*> StyleComputer::collect_matching_rules(DOM::Element c
         if (should_reject_with_ancestor_filter(rule_to_run.selector))
             return;
 
+        if (rule_to_run.prevents_style_sharing)
+            did_run_any_rules_preventing_style_sharing = true;
+
         rules_to_run.unchecked_append(rule_to_run);
     };
 
@@ -1564,30 +1617,40 @@ void StyleComputer::start_needed_transitions(ComputedProperties const& previous_
 
 // https://www.w3.org/TR/css-cascade/#cascading
 // https://drafts.csswg.org/css-cascade-5/#layering
-GC::Ref<CascadedProperties> StyleComputer::compute_cascaded_values(DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, bool& did_match_any_pseudo_element_rules, bool& did_match_any_hover_rules, ComputeStyleMode mode) const
+GC::Ref<CascadedProperties> StyleComputer::compute_cascaded_values(DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element, bool& did_match_any_pseudo_element_rules, bool& did_match_any_hover_rules, bool& did_run_any_rules_preventing_style_sharing, ComputeStyleMode mode) const
 {
     auto cascaded_properties = m_document->heap().allocate<CascadedProperties>();
 
     // First, we collect all the CSS rules whose selectors match `element`:
     MatchingRuleSet matching_rule_set;
-    matching_rule_set.user_agent_rules = collect_matching_rules(element, CascadeOrigin::UserAgent, pseudo_element, did_match_any_hover_rules);
+    matching_rule_set.user_agent_rules = collect_matching_rules(element, CascadeOrigin::UserAgent, pseudo_element, did_match_any_hover_rules, did_run_any_rules_preventing_style_sharing);
     sort_matching_rules(matching_rule_set.user_agent_rules);
-    matching_rule_set.user_rules = collect_matching_rules(element, CascadeOrigin::User, pseudo_element, did_match_any_hover_rules);
+    matching_rule_set.user_rules = collect_matching_rules(element, CascadeOrigin::User, pseudo_element, did_match_any_hover_rules, did_run_any_rules_preventing_style_sharing);
     sort_matching_rules(matching_rule_set.user_rules);
     // @layer-ed author rules
     for (auto const& layer_name : m_qualified_layer_names_in_order) {
-        auto layer_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element, did_match_any_hover_rules, layer_name);
+        auto layer_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element, did_match_any_hover_rules, did_run_any_rules_preventing_style_sharing, layer_name);
         sort_matching_rules(layer_rules);
         matching_rule_set.author_rules.append({ layer_name, layer_rules });
     }
     // Un-@layer-ed author rules
-    auto unlayered_author_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element, did_match_any_hover_rules);
+    auto unlayered_author_rules = collect_matching_rules(element, CascadeOrigin::Author, pseudo_element, did_match_any_hover_rules, did_run_any_rules_preventing_style_sharing);
     sort_matching_rules(unlayered_author_rules);
     matching_rule_set.author_rules.append({ {}, unlayered_author_rules });
 
     if (mode == ComputeStyleMode::CreatePseudoElementStyleIfNeeded) {
         VERIFY(pseudo_element.has_value());
-        if (matching_rule_set.author_rules.is_empty() && matching_rule_set.user_rules.is_empty() && matching_rule_set.user_agent_rules.is_empty()) {
+
+        // NOTE: author_rules always has an entry for the un-@layer-ed rules, so we have to look inside each layer.
+        bool did_match_any_author_rules = false;
+        for (auto const& layer : matching_rule_set.author_rules) {
+            if (!layer.rules.is_empty()) {
+                did_match_any_author_rules = true;
+                break;
+            }
+        }
+
+        if (!did_match_any_author_rules && matching_rule_set.user_rules.is_empty() && matching_rule_set.user_agent_rules.is_empty()) {
             did_match_any_pseudo_element_rules = false;
             return cascaded_properties;
         }
@@ -1678,7 +1741,7 @@ void StyleComputer::compute_defaulted_property_value(ComputedProperties& style,
 {
     // FIXME: If we don't know the correct initial value for a property, we fall back to `initial`.
 
-    auto& value_slot = style.m_property_values[to_underlying(property_id)];
+    auto& value_slot = style.mutable_value_slot(property_id);
     if (!value_slot) {
         if (is_inherited_property(property_id)) {
             style.set_property(
@@ -2169,7 +2232,7 @@ void StyleComputer::absolutize_values(ComputedProperties& style) const
     //       We have to resolve them right away, so that the *computed* line-height is ready for inheritance.
     //       We can't simply absolutize *all* percentage values against the font size,
     //       because most percentages are relative to containing block metrics.
-    auto& line_height_value_slot = style.m_property_values[to_underlying(CSS::PropertyID::LineHeight)];
+    auto& line_height_value_slot = style.mutable_value_slot(CSS::PropertyID::LineHeight);
     if (line_height_value_slot && line_height_value_slot->is_percentage()) {
         line_height_value_slot = LengthStyleValue::create(
             Length::make_px(CSSPixels::nearest_value_for(font_size * static_cast<double>(line_height_value_slot->as_percentage().percentage().as_fraction()))));
@@ -2182,8 +2245,8 @@ void StyleComputer::absolutize_values(ComputedProperties& style) const
     if (line_height_value_slot && line_height_value_slot->is_length())
         line_height_value_slot = LengthStyleValue::create(Length::make_px(line_height));
 
-    for (size_t i = 0; i < style.m_property_values.size(); ++i) {
-        auto& value_slot = style.m_property_values[i];
+    for (size_t i = 0; i < ComputedProperties::number_of_properties; ++i) {
+        auto& value_slot = style.mutable_value_slot(static_cast<PropertyID>(i));
         if (!value_slot)
             continue;
         value_slot = value_slot->absolutized(viewport_rect(), font_metrics, m_root_element_font_metrics);
@@ -2398,6 +2461,74 @@ GC::Ref<ComputedProperties> StyleComputer::compute_style(DOM::Element& element,
     return *compute_style_impl(element, move(pseudo_element), ComputeStyleMode::Normal);
 }
 
+static bool element_may_share_style(DOM::Element const& element)
+{
+    if (element.inline_style() || element.is_shadow_host() || element.use_pseudo_element().has_value() || element.is_custom())
+        return false;
+
+    auto const* parent = element.parent_element();
+    if (!parent || parent->is_shadow_host())
+        return false;
+
+    if (element.has_associated_animations() || element.cached_transition_property_source() || element.cached_animation_name_source({}))
+        return false;
+
+    if (element.is_active() || element.is_target())
+        return false;
+
+    auto const& document = element.document();
+    if (auto const* hovered_node = document.hovered_node(); hovered_node && element.is_shadow_including_inclusive_ancestor_of(*hovered_node))
+        return false;
+    if (auto const* focused_element = document.focused_element(); focused_element && element.is_shadow_including_inclusive_ancestor_of(*focused_element))
+        return false;
+
+    return true;
+}
+
+static bool elements_have_identical_attributes(DOM::Element const& a, DOM::Element const& b)
+{
+    auto attribute_count = a.attribute_list_size();
+    if (attribute_count != b.attribute_list_size())
+        return false;
+    for (u32 i = 0; i < attribute_count; ++i) {
+        auto const& a_attribute = *a.attributes()->item(i);
+        auto const& b_attribute = *b.attributes()->item(i);
+        if (a_attribute.local_name() != b_attribute.local_name()
+            || a_attribute.namespace_uri() != b_attribute.namespace_uri()
+            || a_attribute.value() != b_attribute.value())
+            return false;
+    }
+    return true;
+}
+
+GC::Ptr<ComputedProperties> StyleComputer::try_share_style_with_sibling(DOM::Element& element) const
+{
+    // NOTE: Looking further back rarely finds anything that the nearest siblings didn't, so keep the search short.
+    static constexpr size_t max_siblings_to_check = 4;
+
+    if (!element_may_share_style(element))
+        return nullptr;
+
+    size_t checked_siblings = 0;
+    for (auto* sibling = element.previous_element_sibling(); sibling && checked_siblings < max_siblings_to_check; sibling = sibling->previous_element_sibling(), ++checked_siblings) {
+        auto sibling_style = sibling->computed_properties();
+        if (!sibling_style || !sibling_style->is_shareable_with_siblings() || sibling->needs_style_update())
+            continue;
+        if (sibling->local_name() != element.local_name() || sibling->namespace_uri() != element.namespace_uri())
+            continue;
+        if (!elements_have_identical_attributes(*sibling, element) || !element_may_share_style(*sibling))
+            continue;
+
+        // NOTE: Sharing skips the cascade, so copy over what it would have recorded on the element as well. Descendants
+        //       look up var() values on it, and custom property invalidation depends on the flag.
+        element.set_cascaded_properties({}, sibling->cascaded_properties({}));
+        element.set_custom_properties({}, sibling->custom_properties({}));
+        element.set_style_uses_css_custom_properties(sibling->style_uses_css_custom_properties());
+        return sibling_style->clone();
+    }
+    return nullptr;
+}
+
 GC::Ptr<ComputedProperties> StyleComputer::compute_pseudo_element_style_if_needed(DOM::Element& element, Optional<CSS::Selector::PseudoElement::Type> pseudo_element) const
 {
     return compute_style_impl(element, move(pseudo_element), ComputeStyleMode::CreatePseudoElementStyleIfNeeded);
@@ -2425,7 +2556,8 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::Element& elem
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
     bool did_match_any_hover_rules = false;
-    auto cascaded_properties = compute_cascaded_values(element, pseudo_element, did_match_any_pseudo_element_rules, did_match_any_hover_rules, mode);
+    bool did_run_any_rules_preventing_style_sharing = false;
+    auto cascaded_properties = compute_cascaded_values(element, pseudo_element, did_match_any_pseudo_element_rules, did_match_any_hover_rules, did_run_any_rules_preventing_style_sharing, mode);
 
     element.set_cascaded_properties(pseudo_element, cascaded_properties);
 
@@ -2433,7 +2565,8 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::Element& elem
         // NOTE: If we're computing style for a pseudo-element, we look for a number of reasons to bail early.
 
         // Bail if no pseudo-element rules matched.
-        if (!did_match_any_pseudo_element_rules)
+        // NOTE: List items always generate a ::marker box, which needs a style whether or not any rules target it.
+        if (!did_match_any_pseudo_element_rules && pseudo_element != CSS::Selector::PseudoElement::Type::Marker)
             return {};
 
         // Bail if no pseudo-element would be generated due to...
@@ -2461,6 +2594,14 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::Element& elem
     auto computed_properties = compute_properties(element, pseudo_element, cascaded_properties);
     if (did_match_any_hover_rules)
         computed_properties->set_did_match_any_hover_rules();
+
+    // NOTE: Animations and transitions are per-element state, so styles that set them up are never shared.
+    if (!pseudo_element.has_value()
+        && !did_run_any_rules_preventing_style_sharing
+        && !computed_properties->animation_name_source()
+        && !computed_properties->transition_property_source())
+        computed_properties->set_is_shareable_with_siblings();
+
     return computed_properties;
 }
 
@@ -2602,6 +2743,19 @@ GC::Ref<ComputedProperties> StyleComputer::compute_properties(DOM::Element& elem
         start_needed_transitions(*previous_style, computed_style, element, pseudo_element);
     }
 
+    // 10. Reuse property groups that came out identical to the parent's or the previous sibling's, to save memory.
+    {
+        ComputedProperties const* parent_style = nullptr;
+        if (auto inheritance_parent = element_to_inherit_style_from(&element, pseudo_element))
+            parent_style = inheritance_parent->computed_properties().ptr();
+        ComputedProperties const* previous_sibling_style = nullptr;
+        if (!pseudo_element.has_value()) {
+            if (auto const* sibling = element.previous_element_sibling())
+                previous_sibling_style = sibling->computed_properties().ptr();
+        }
+        computed_style->share_identical_property_groups_with(parent_style, previous_sibling_style);
+    }
+
     return computed_style;
 }
 
@@ -2664,16 +2818,196 @@ void StyleComputer::collect_selector_insights(Selector const& selector, Selector
     }
 }
 
-void StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin, SelectorInsights& insights, Vector<MatchingRule>& hover_rules)
+// Whether matching this selector against an element may depend on something other than the element's own
+// name, attributes, ancestors and interaction state. Elements that only ran rules that return false here can
+// share their style with an identical-looking sibling.
+static bool selector_prevents_style_sharing(Selector const& selector)
 {
-    size_t num_class_rules = 0;
-    size_t num_id_rules = 0;
-    size_t num_tag_name_rules = 0;
-    size_t num_pseudo_element_rules = 0;
-    size_t num_root_rules = 0;
-    size_t num_attribute_rules = 0;
-    size_t num_hover_rules = 0;
+    auto const& subject = selector.compound_selectors().last();
+    if (subject.combinator == Selector::Combinator::NextSibling || subject.combinator == Selector::Combinator::SubsequentSibling)
+        return true;
+
+    for (auto const& simple_selector : subject.simple_selectors) {
+        if (simple_selector.type != Selector::SimpleSelector::Type::PseudoClass)
+            continue;
+        switch (simple_selector.pseudo_class().type) {
+        case PseudoClass::Is:
+        case PseudoClass::Where:
+        case PseudoClass::Not:
+            for (auto const& argument_selector : simple_selector.pseudo_class().argument_selector_list) {
+                if (selector_prevents_style_sharing(*argument_selector))
+                    return true;
+            }
+            break;
+        // NOTE: These depend on interaction state, which try_share_style_with_sibling() checks on the element itself.
+        case PseudoClass::Hover:
+        case PseudoClass::Active:
+        case PseudoClass::Focus:
+        case PseudoClass::FocusVisible:
+        case PseudoClass::FocusWithin:
+        case PseudoClass::Target:
+        case PseudoClass::Root:
+        case PseudoClass::Lang:
+        case PseudoClass::Scope:
+            break;
+        default:
+            return true;
+        }
+    }
+    return false;
+}
 
+void StyleComputer::add_rule_to_rule_caches(RuleCaches& rule_caches, CSSRule const& rule, CSSStyleSheet const& sheet, GC::Ptr<DOM::ShadowRoot const> shadow_root, CascadeOrigin cascade_origin, size_t style_sheet_index, size_t rule_index, SelectorInsights& insights, Vector<MatchingRule>& hover_rules)
+{
+    SelectorList const& absolutized_selectors = [&]() {
+        if (rule.type() == CSSRule::Type::Style)
+            return static_cast<CSSStyleRule const&>(rule).absolutized_selectors();
+        if (rule.type() == CSSRule::Type::NestedDeclarations)
+            return static_cast<CSSNestedDeclarations const&>(rule).parent_style_rule().absolutized_selectors();
+        VERIFY_NOT_REACHED();
+    }();
+
+    for (auto const& selector : absolutized_selectors) {
+        m_style_invalidation_data->build_invalidation_sets_for_selector(selector);
+    }
+
+    for (CSS::Selector const& selector : absolutized_selectors) {
+        MatchingRule matching_rule {
+            shadow_root,
+            &rule,
+            sheet,
+            sheet.default_namespace(),
+            selector,
+            style_sheet_index,
+            rule_index,
+            selector.specificity(),
+            cascade_origin,
+            false,
+            false,
+            selector_prevents_style_sharing(selector),
+        };
+
+        auto const& qualified_layer_name = matching_rule.qualified_layer_name();
+        auto& rule_cache = qualified_layer_name.is_empty() ? rule_caches.main : *rule_caches.by_layer.ensure(qualified_layer_name, [] { return make<RuleCache>(); });
+
+        bool contains_root_pseudo_class = false;
+        Optional<CSS::Selector::PseudoElement::Type> pseudo_element;
+
+        collect_selector_insights(selector, insights);
+
+        for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+            if (!matching_rule.contains_pseudo_element) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
+                    matching_rule.contains_pseudo_element = true;
+                    pseudo_element = simple_selector.pseudo_element().type();
+                }
+            }
+            if (!contains_root_pseudo_class) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
+                    && simple_selector.pseudo_class().type == CSS::PseudoClass::Root) {
+                    contains_root_pseudo_class = true;
+                }
+            }
+
+            if (!matching_rule.must_be_hovered) {
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass && simple_selector.pseudo_class().type == CSS::PseudoClass::Hover) {
+                    matching_rule.must_be_hovered = true;
+                }
+                if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
+                    && (simple_selector.pseudo_class().type == CSS::PseudoClass::Is
+                        || simple_selector.pseudo_class().type == CSS::PseudoClass::Where)) {
+                    auto const& argument_selectors = simple_selector.pseudo_class().argument_selector_list;
+
+                    if (argument_selectors.size() == 1) {
+                        auto const& simple_argument_selector = argument_selectors.first()->compound_selectors().last().simple_selectors.last();
+                        if (simple_argument_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
+                            && simple_argument_selector.pseudo_class().type == CSS::PseudoClass::Hover) {
+                            matching_rule.must_be_hovered = true;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (selector.contains_hover_pseudo_class()) {
+            hover_rules.append(matching_rule);
+        }
+
+        // NOTE: We traverse the simple selectors in reverse order to make sure that class/ID buckets are preferred over tag buckets
+        //       in the common case of div.foo or div#foo selectors.
+        bool added_to_bucket = false;
+
+        auto add_to_id_bucket = [&](FlyString const& name) {
+            rule_cache.rules_by_id.ensure(name).append(move(matching_rule));
+            added_to_bucket = true;
+        };
+
+        auto add_to_class_bucket = [&](FlyString const& name) {
+            rule_cache.rules_by_class.ensure(name).append(move(matching_rule));
+            added_to_bucket = true;
+        };
+
+        auto add_to_tag_name_bucket = [&](FlyString const& name) {
+            rule_cache.rules_by_tag_name.ensure(name).append(move(matching_rule));
+            added_to_bucket = true;
+        };
+
+        for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors.in_reverse()) {
+            if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Id) {
+                add_to_id_bucket(simple_selector.name());
+                break;
+            }
+            if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Class) {
+                add_to_class_bucket(simple_selector.name());
+                break;
+            }
+            if (simple_selector.type == CSS::Selector::SimpleSelector::Type::TagName) {
+                add_to_tag_name_bucket(simple_selector.qualified_name().name.lowercase_name);
+                break;
+            }
+            // NOTE: Selectors like `:is/where(.foo)` and `:is/where(.foo .bar)` are bucketed as class selectors for `foo` and `bar` respectively.
+            if (auto simplified = is_roundabout_selector_bucketable_as_something_simpler(simple_selector); simplified.has_value()) {
+                if (simplified->type == CSS::Selector::SimpleSelector::Type::TagName) {
+                    add_to_tag_name_bucket(simplified->name);
+                    break;
+                }
+                if (simplified->type == CSS::Selector::SimpleSelector::Type::Class) {
+                    add_to_class_bucket(simplified->name);
+                    break;
+                }
+                if (simplified->type == CSS::Selector::SimpleSelector::Type::Id) {
+                    add_to_id_bucket(simplified->name);
+                    break;
+                }
+            }
+        }
+        if (!added_to_bucket) {
+            if (matching_rule.contains_pseudo_element) {
+                if (CSS::Selector::PseudoElement::is_known_pseudo_element_type(pseudo_element.value())) {
+                    rule_cache.rules_by_pseudo_element[to_underlying(pseudo_element.value())].append(move(matching_rule));
+                } else {
+                    // NOTE: We don't cache rules for unknown pseudo-elements. They can't match anything anyway.
+                }
+            } else if (contains_root_pseudo_class) {
+                rule_cache.root_rules.append(move(matching_rule));
+            } else {
+                for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
+                    if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Attribute) {
+                        rule_cache.rules_by_attribute_name.ensure(simple_selector.attribute().qualified_name.name.lowercase_name).append(move(matching_rule));
+                        added_to_bucket = true;
+                        break;
+                    }
+                }
+                if (!added_to_bucket) {
+                    rule_cache.other_rules.append(move(matching_rule));
+                }
+            }
+        }
+    }
+}
+
+void StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_origin, SelectorInsights& insights, Vector<MatchingRule>& hover_rules)
+{
     Vector<MatchingRule> matching_rules;
     size_t style_sheet_index = 0;
     for_each_stylesheet(cascade_origin, [&](auto& sheet, GC::Ptr<DOM::ShadowRoot> shadow_root) {
@@ -2699,160 +3033,11 @@ void StyleComputer::make_rule_cache_for_cascade_origin(CascadeOrigin cascade_ori
 
         size_t rule_index = 0;
         sheet.for_each_effective_style_producing_rule([&](auto const& rule) {
-            SelectorList const& absolutized_selectors = [&]() {
-                if (rule.type() == CSSRule::Type::Style)
-                    return static_cast<CSSStyleRule const&>(rule).absolutized_selectors();
-                if (rule.type() == CSSRule::Type::NestedDeclarations)
-                    return static_cast<CSSNestedDeclarations const&>(rule).parent_style_rule().absolutized_selectors();
-                VERIFY_NOT_REACHED();
-            }();
-
-            for (auto const& selector : absolutized_selectors) {
-                m_style_invalidation_data->build_invalidation_sets_for_selector(selector);
-            }
-
-            for (CSS::Selector const& selector : absolutized_selectors) {
-                MatchingRule matching_rule {
-                    shadow_root,
-                    &rule,
-                    sheet,
-                    sheet.default_namespace(),
-                    selector,
-                    style_sheet_index,
-                    rule_index,
-                    selector.specificity(),
-                    cascade_origin,
-                    false,
-                    false,
-                };
-
-                auto const& qualified_layer_name = matching_rule.qualified_layer_name();
-                auto& rule_cache = qualified_layer_name.is_empty() ? rule_caches.main : *rule_caches.by_layer.ensure(qualified_layer_name, [] { return make<RuleCache>(); });
-
-                bool contains_root_pseudo_class = false;
-                Optional<CSS::Selector::PseudoElement::Type> pseudo_element;
-
-                collect_selector_insights(selector, insights);
-
-                for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
-                    if (!matching_rule.contains_pseudo_element) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoElement) {
-                            matching_rule.contains_pseudo_element = true;
-                            pseudo_element = simple_selector.pseudo_element().type();
-                            ++num_pseudo_element_rules;
-                        }
-                    }
-                    if (!contains_root_pseudo_class) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
-                            && simple_selector.pseudo_class().type == CSS::PseudoClass::Root) {
-                            contains_root_pseudo_class = true;
-                            ++num_root_rules;
-                        }
-                    }
-
-                    if (!matching_rule.must_be_hovered) {
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass && simple_selector.pseudo_class().type == CSS::PseudoClass::Hover) {
-                            matching_rule.must_be_hovered = true;
-                            ++num_hover_rules;
-                        }
-                        if (simple_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
-                            && (simple_selector.pseudo_class().type == CSS::PseudoClass::Is
-                                || simple_selector.pseudo_class().type == CSS::PseudoClass::Where)) {
-                            auto const& argument_selectors = simple_selector.pseudo_class().argument_selector_list;
-
-                            if (argument_selectors.size() == 1) {
-                                auto const& simple_argument_selector = argument_selectors.first()->compound_selectors().last().simple_selectors.last();
-                                if (simple_argument_selector.type == CSS::Selector::SimpleSelector::Type::PseudoClass
-                                    && simple_argument_selector.pseudo_class().type == CSS::PseudoClass::Hover) {
-                                    matching_rule.must_be_hovered = true;
-                                    ++num_hover_rules;
-                                }
-                            }
-                        }
-                    }
-                }
-
-                if (selector.contains_hover_pseudo_class()) {
-                    hover_rules.append(matching_rule);
-                }
-
-                // NOTE: We traverse the simple selectors in reverse order to make sure that class/ID buckets are preferred over tag buckets
-                //       in the common case of div.foo or div#foo selectors.
-                bool added_to_bucket = false;
-
-                auto add_to_id_bucket = [&](FlyString const& name) {
-                    rule_cache.rules_by_id.ensure(name).append(move(matching_rule));
-                    ++num_id_rules;
-                    added_to_bucket = true;
-                };
-
-                auto add_to_class_bucket = [&](FlyString const& name) {
-                    rule_cache.rules_by_class.ensure(name).append(move(matching_rule));
-                    ++num_class_rules;
-                    added_to_bucket = true;
-                };
-
-                auto add_to_tag_name_bucket = [&](FlyString const& name) {
-                    rule_cache.rules_by_tag_name.ensure(name).append(move(matching_rule));
-                    ++num_tag_name_rules;
-                    added_to_bucket = true;
-                };
-
-                for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors.in_reverse()) {
-                    if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Id) {
-                        add_to_id_bucket(simple_selector.name());
-                        break;
-                    }
-                    if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Class) {
-                        add_to_class_bucket(simple_selector.name());
-                        break;
-                    }
-                    if (simple_selector.type == CSS::Selector::SimpleSelector::Type::TagName) {
-                        add_to_tag_name_bucket(simple_selector.qualified_name().name.lowercase_name);
-                        break;
-                    }
-                    // NOTE: Selectors like `:is/where(.foo)` and `:is/where(.foo .bar)` are bucketed as class selectors for `foo` and `bar` respectively.
-                    if (auto simplified = is_roundabout_selector_bucketable_as_something_simpler(simple_selector); simplified.has_value()) {
-                        if (simplified->type == CSS::Selector::SimpleSelector::Type::TagName) {
-                            add_to_tag_name_bucket(simplified->name);
-                            break;
-                        }
-                        if (simplified->type == CSS::Selector::SimpleSelector::Type::Class) {
-                            add_to_class_bucket(simplified->name);
-                            break;
-                        }
-                        if (simplified->type == CSS::Selector::SimpleSelector::Type::Id) {
-                            add_to_id_bucket(simplified->name);
-                            break;
-                        }
-                    }
-                }
-                if (!added_to_bucket) {
-                    if (matching_rule.contains_pseudo_element) {
-                        if (CSS::Selector::PseudoElement::is_known_pseudo_element_type(pseudo_element.value())) {
-                            rule_cache.rules_by_pseudo_element[to_underlying(pseudo_element.value())].append(move(matching_rule));
-                        } else {
-                            // NOTE: We don't cache rules for unknown pseudo-elements. They can't match anything anyway.
-                        }
-                    } else if (contains_root_pseudo_class) {
-                        rule_cache.root_rules.append(move(matching_rule));
-                    } else {
-                        for (auto const& simple_selector : selector.compound_selectors().last().simple_selectors) {
-                            if (simple_selector.type == CSS::Selector::SimpleSelector::Type::Attribute) {
-                                rule_cache.rules_by_attribute_name.ensure(simple_selector.attribute().qualified_name.name.lowercase_name).append(move(matching_rule));
-                                ++num_attribute_rules;
-                                added_to_bucket = true;
-                                break;
-                            }
-                        }
-                        if (!added_to_bucket) {
-                            rule_cache.other_rules.append(move(matching_rule));
-                        }
-                    }
-                }
-            }
+            add_rule_to_rule_caches(rule_caches, rule, sheet, shadow_root, cascade_origin, style_sheet_index, rule_index, insights, hover_rules);
             ++rule_index;
         });
+        if (cascade_origin == CascadeOrigin::Author)
+            m_author_rule_cache->next_rule_index_by_style_sheet.set(sheet, rule_index);
 
         // Loosely based on https://drafts.csswg.org/css-animations-2/#keyframe-processing
         sheet.for_each_effective_keyframes_at_rule([&](CSSKeyframesRule const& rule) {
@@ -2963,6 +3148,8 @@ void StyleComputer::build_qualified_layer_names_cache()
 
 void StyleComputer::build_rule_cache()
 {
+    ++m_rule_cache_build_count;
+
     m_author_rule_cache = make<RuleCachesForDocumentAndShadowRoots>();
     m_user_rule_cache = make<RuleCachesForDocumentAndShadowRoots>();
     m_user_agent_rule_cache = make<RuleCachesForDocumentAndShadowRoots>();
@@ -2999,6 +3186,98 @@ void StyleComputer::invalidate_rule_cache()
     m_style_invalidation_data = nullptr;
 }
 
+// Whether inserting or removing this rule only adds or removes its own MatchingRules, without affecting the
+// rule_index of any other rule in the cache.
+static bool rule_can_be_updated_in_rule_cache_incrementally(CSSRule const& rule)
+{
+    if (rule.type() != CSSRule::Type::Style || rule.parent_rule())
+        return false;
+    return static_cast<CSSStyleRule const&>(rule).css_rules().length() == 0;
+}
+
+void StyleComputer::did_insert_rule_into_style_sheet(CSSStyleSheet const& sheet, CSSRule const& rule)
+{
+    if (!has_valid_rule_cache())
+        return;
+
+    // NOTE: Rules are sorted by (specificity, style_sheet_index, rule_index) after being collected, so the order within
+    //       each bucket doesn't matter. A rule appended to the end of a sheet gets a rule_index greater than any that
+    //       sheet has used before, but a rule inserted anywhere else would shift the rule_index of every rule after it.
+    auto const& rules = sheet.rules();
+    if (!rule_can_be_updated_in_rule_cache_incrementally(rule) || rules.length() == 0 || rules.item(rules.length() - 1) != &rule) {
+        invalidate_rule_cache();
+        return;
+    }
+
+    bool found_sheet = false;
+    size_t style_sheet_index = 0;
+    Optional<size_t> rule_index;
+    for_each_stylesheet(CascadeOrigin::Author, [&](auto& active_sheet, GC::Ptr<DOM::ShadowRoot> shadow_root) {
+        if (&active_sheet == &sheet) {
+            found_sheet = true;
+            bool is_effective = false;
+            active_sheet.for_each_effective_style_producing_rule([&](CSSRule const& effective_rule) {
+                if (&effective_rule == &rule)
+                    is_effective = true;
+            });
+            if (is_effective) {
+                // NOTE: A sheet that is adopted by both the document and its shadow roots is visited once for each of
+                //       them, and the rule has the same rule_index in all of them.
+                if (!rule_index.has_value())
+                    rule_index = m_author_rule_cache->next_rule_index_by_style_sheet.ensure(sheet)++;
+                auto& rule_caches = shadow_root ? *m_author_rule_cache->for_shadow_roots.ensure(*shadow_root, [] { return make<RuleCaches>(); }) : m_author_rule_cache->for_document;
+                add_rule_to_rule_caches(rule_caches, rule, sheet, shadow_root, CascadeOrigin::Author, style_sheet_index, *rule_index, *m_selector_insights, m_hover_rules);
+            }
+        }
+        ++style_sheet_index;
+    });
+
+    // NOTE: Sheets that are imported by another sheet don't have a style_sheet_index of their own.
+    if (!found_sheet)
+        invalidate_rule_cache();
+}
+
+void StyleComputer::did_remove_rule_from_style_sheet(CSSRule const& rule)
+{
+    if (!has_valid_rule_cache())
+        return;
+
+    if (!rule_can_be_updated_in_rule_cache_incrementally(rule)) {
+        invalidate_rule_cache();
+        return;
+    }
+
+    // NOTE: Removing a rule leaves a gap in the rule_index sequence of its sheet, which doesn't change the relative order
+    //       of the remaining rules. The gap is never filled, since appended rules always get a new rule_index. Invalidation sets and selector insights are left as they are, which is conservative.
+    auto remove_matching_rules = [&](Vector<MatchingRule>& matching_rules) {
+        matching_rules.remove_all_matching([&](auto const& matching_rule) { return matching_rule.rule == &rule; });
+    };
+    auto remove_from_rule_cache = [&](RuleCache& rule_cache) {
+        for (auto& it : rule_cache.rules_by_id)
+            remove_matching_rules(it.value);
+        for (auto& it : rule_cache.rules_by_class)
+            remove_matching_rules(it.value);
+        for (auto& it : rule_cache.rules_by_tag_name)
+            remove_matching_rules(it.value);
+        for (auto& it : rule_cache.rules_by_attribute_name)
+            remove_matching_rules(it.value);
+        for (auto& rules : rule_cache.rules_by_pseudo_element)
+            remove_matching_rules(rules);
+        remove_matching_rules(rule_cache.root_rules);
+        remove_matching_rules(rule_cache.other_rules);
+    };
+    auto remove_from_rule_caches = [&](RuleCaches& rule_caches) {
+        remove_from_rule_cache(rule_caches.main);
+        for (auto& it : rule_caches.by_layer)
+            remove_from_rule_cache(*it.value);
+    };
+
+    remove_from_rule_caches(m_author_rule_cache->for_document);
+    for (auto& it : m_author_rule_cache->for_shadow_roots)
+        remove_from_rule_caches(*it.value);
+    remove_matching_rules(m_hover_rules);
+}
+
 void StyleComputer::did_load_font(FlyString const&)
 {
     document().invalidate_style(DOM::StyleInvalidationReason::CSSFontLoaded);
@@ -87,6 +87,7 @@ struct MatchingRule {
     CascadeOrigin cascade_origin;
     bool contains_pseudo_element { false };
     bool must_be_hovered { false };
+    bool prevents_style_sharing { false };
 
     // Helpers to deal with the fact that `rule` might be a CSSStyleRule or a CSSNestedDeclarations
     PropertyOwningCSSStyleDeclaration const& declaration() const;
@@ -147,14 +148,25 @@ public:
     [[nodiscard]] GC::Ptr<ComputedProperties> compute_pseudo_element_style_if_needed(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>) const;
 
     Vector<MatchingRule> const& get_hover_rules() const;
-    [[nodiscard]] Vector<MatchingRule const*> collect_matching_rules(DOM::Element const&, CascadeOrigin, Optional<CSS::Selector::PseudoElement::Type>, bool& did_match_any_hover_rules, FlyString const& qualified_layer_name = {}) const;
+    [[nodiscard]] Vector<MatchingRule const*> collect_matching_rules(DOM::Element const&, CascadeOrigin, Optional<CSS::Selector::PseudoElement::Type>, bool& did_match_any_hover_rules, bool& did_run_any_rules_preventing_style_sharing, FlyString const& qualified_layer_name = {}) const;
+
+    // Returns a copy of a recent sibling's style if nothing that the cascade looks at could tell the two elements apart.
+    [[nodiscard]] GC::Ptr<ComputedProperties> try_share_style_with_sibling(DOM::Element&) const;
 
     InvalidationSet invalidation_set_for_properties(Vector<InvalidationSet::Property> const&) const;
     bool invalidation_property_used_in_has_selector(InvalidationSet::Property const&) const;
+    [[nodiscard]] bool may_affect_has_selectors_when_inserted_or_removed(DOM::Node const&) const;
 
     [[nodiscard]] bool has_valid_rule_cache() const { return m_author_rule_cache; }
     void invalidate_rule_cache();
 
+    // Update the author rule cache after a rule was inserted into, or removed from, an author style sheet.
+    // These fall back to invalidate_rule_cache() when the cache can't be updated in place.
+    void did_insert_rule_into_style_sheet(CSSStyleSheet const&, CSSRule const&);
+    void did_remove_rule_from_style_sheet(CSSRule const&);
+
+    size_t rule_cache_build_count() const { return m_rule_cache_build_count; }
+
     Gfx::Font const& initial_font() const;
 
     void did_load_font(FlyString const& family_name);
@@ -197,7 +209,7 @@ private:
     struct MatchingFontCandidate;
 
     [[nodiscard]] GC::Ptr<ComputedProperties> compute_style_impl(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, ComputeStyleMode) const;
-    [[nodiscard]] GC::Ref<CascadedProperties> compute_cascaded_values(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, bool& did_match_any_pseudo_element_rules, bool& did_match_any_hover_rules, ComputeStyleMode) const;
+    [[nodiscard]] GC::Ref<CascadedProperties> compute_cascaded_values(DOM::Element&, Optional<CSS::Selector::PseudoElement::Type>, bool& did_match_any_pseudo_element_rules, bool& did_match_any_hover_rules, bool& did_run_any_rules_preventing_style_sharing, ComputeStyleMode) const;
     static RefPtr<Gfx::FontCascadeList const> find_matching_font_weight_ascending(Vector<MatchingFontCandidate> const& candidates, int target_weight, float font_size_in_pt, bool inclusive);
     static RefPtr<Gfx::FontCascadeList const> find_matching_font_weight_descending(Vector<MatchingFontCandidate> const& candidates, int target_weight, float font_size_in_pt, bool inclusive);
     RefPtr<Gfx::FontCascadeList const> font_matching_algorithm(FlyString const& family_name, int weight, int slope, float font_size_in_pt) const;
@@ -279,9 +291,14 @@ private:
     struct RuleCachesForDocumentAndShadowRoots {
         RuleCaches for_document;
         HashMap<GC::Ref<DOM::ShadowRoot const>, NonnullOwnPtr<RuleCaches>> for_shadow_roots;
+
+        // The rule_index for the next rule appended to each sheet. It only ever increases, so the rule_index of a
+        // deleted rule is never handed out again while rules after it still use theirs.
+        HashMap<GC::Ref<CSSStyleSheet const>, size_t> next_rule_index_by_style_sheet;
     };
 
     void make_rule_cache_for_cascade_origin(CascadeOrigin, SelectorInsights&, Vector<MatchingRule>& hover_rules);
+    void add_rule_to_rule_caches(RuleCaches&, CSSRule const&, CSSStyleSheet const&, GC::Ptr<DOM::ShadowRoot const>, CascadeOrigin, size_t style_sheet_index, size_t rule_index, SelectorInsights&, Vector<MatchingRule>& hover_rules);
 
     [[nodiscard]] RuleCache const* rule_cache_for_cascade_origin(CascadeOrigin, FlyString const& qualified_layer_name, GC::Ptr<DOM::ShadowRoot const>) const;
 
@@ -293,6 +310,7 @@ private:
     OwnPtr<RuleCachesForDocumentAndShadowRoots> m_author_rule_cache;
     OwnPtr<RuleCachesForDocumentAndShadowRoots> m_user_rule_cache;
     OwnPtr<RuleCachesForDocumentAndShadowRoots> m_user_agent_rule_cache;
+    size_t m_rule_cache_build_count { 0 };
     GC::Root<CSSStyleSheet> m_user_style_sheet;
 
     using FontLoaderList = Vector<NonnullOwnPtr<FontLoader>>;
@@ -18,8 +18,8 @@ RequiredInvalidationAfterStyleChange compute_property_invalidation(CSS::Property
     if (!property_value_changed)
         return invalidation;
 
-    // NOTE: If the computed CSS display, content, or content-visibility property changes, we have to rebuild the entire layout tree.
-    //       In the future, we should figure out ways to rebuild a smaller part of the tree.
+    // NOTE: If the computed CSS display, content, or content-visibility property changes, we have to rebuild the part of
+    //       the layout tree around the element.
     if (AK::first_is_one_of(property_id, CSS::PropertyID::Display, CSS::PropertyID::Content, CSS::PropertyID::ContentVisibility)) {
         return RequiredInvalidationAfterStyleChange::full();
     }
@@ -41,6 +41,70 @@ static void for_each_consecutive_simple_selector_group(Selector const& selector,
     }
 }
 
+// Returns whether inserting or removing an element can only change the match result of `selector` (an argument of
+// :has()) if the element, or one of its descendants, has one of the ids, classes, attribute names or tag names
+// that the selector mentions.
+static bool has_argument_is_only_affected_by_elements_it_mentions(Selector const& selector)
+{
+    for (auto const& compound_selector : selector.compound_selectors()) {
+        // Removing an element can make two others adjacent, without either of them being inserted or removed.
+        if (compound_selector.combinator == Selector::Combinator::NextSibling || compound_selector.combinator == Selector::Combinator::SubsequentSibling)
+            return false;
+
+        bool mentions_any_property = false;
+        for (auto const& simple_selector : compound_selector.simple_selectors) {
+            switch (simple_selector.type) {
+            case Selector::SimpleSelector::Type::Id:
+            case Selector::SimpleSelector::Type::Class:
+            case Selector::SimpleSelector::Type::Attribute:
+            case Selector::SimpleSelector::Type::TagName:
+                mentions_any_property = true;
+                break;
+            case Selector::SimpleSelector::Type::Universal:
+                break;
+            case Selector::SimpleSelector::Type::PseudoClass: {
+                auto const& pseudo_class = simple_selector.pseudo_class();
+                switch (pseudo_class.type) {
+                case PseudoClass::Is:
+                case PseudoClass::Where:
+                    for (auto const& argument_selector : pseudo_class.argument_selector_list) {
+                        if (!has_argument_is_only_affected_by_elements_it_mentions(*argument_selector))
+                            return false;
+                    }
+                    mentions_any_property = true;
+                    break;
+                // NOTE: These depend on the state of the element itself, and changes to that state are invalidated separately.
+                case PseudoClass::Active:
+                case PseudoClass::AnyLink:
+                case PseudoClass::Checked:
+                case PseudoClass::Defined:
+                case PseudoClass::Disabled:
+                case PseudoClass::Enabled:
+                case PseudoClass::Focus:
+                case PseudoClass::FocusVisible:
+                case PseudoClass::Hover:
+                case PseudoClass::Link:
+                case PseudoClass::LocalLink:
+                case PseudoClass::PlaceholderShown:
+                case PseudoClass::Visited:
+                    break;
+                default:
+                    // Structural pseudo-classes (:empty, :nth-child(), ...), :not() and friends can change as
+                    // unrelated elements come and go.
+                    return false;
+                }
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+        if (!mentions_any_property)
+            return false;
+    }
+    return true;
+}
+
 static void collect_properties_used_in_has(Selector::SimpleSelector const& selector, StyleInvalidationData& style_invalidation_data, bool in_has)
 {
     switch (selector.type) {
@@ -78,6 +142,12 @@ static void collect_properties_used_in_has(Selector::SimpleSelector const& selec
             if (in_has)
                 style_invalidation_data.pseudo_classes_used_in_has_selectors.set(pseudo_class.type);
             break;
+        case PseudoClass::Has:
+            for (auto const& argument_selector : pseudo_class.argument_selector_list) {
+                if (!has_argument_is_only_affected_by_elements_it_mentions(*argument_selector))
+                    style_invalidation_data.has_selectors_affected_by_any_insertion_or_removal = true;
+            }
+            break;
         default:
             break;
         }
@@ -20,6 +20,10 @@ struct StyleInvalidationData {
     HashTable<FlyString> tag_names_used_in_has_selectors;
     HashTable<PseudoClass> pseudo_classes_used_in_has_selectors;
 
+    // Set if some :has() argument could change its match when an element that has none of the ids, classes,
+    // attribute names and tag names above is inserted or removed (e.g. ":has(> *)" or ":has(+ .a)").
+    bool has_selectors_affected_by_any_insertion_or_removal { false };
+
     void build_invalidation_sets_for_selector(Selector const& selector);
 };
 
@@ -20,6 +20,22 @@ namespace Web::CSS {
 
 ValueComparingNonnullRefPtr<CSSColorValue> CSSColorValue::create_from_color(Color color, Optional<FlyString> name)
 {
+    // OPTIMIZATION: Share instances of the most common unnamed colors.
+    if (!name.has_value()) {
+        if (color == Color::Black) {
+            static auto const instance = CSSRGB::create(NumberStyleValue::create(0), NumberStyleValue::create(0), NumberStyleValue::create(0), NumberStyleValue::create(1));
+            return instance;
+        }
+        if (color == Color::White) {
+            static auto const instance = CSSRGB::create(NumberStyleValue::create(255), NumberStyleValue::create(255), NumberStyleValue::create(255), NumberStyleValue::create(1));
+            return instance;
+        }
+        if (color == Color::Transparent) {
+            static auto const instance = CSSRGB::create(NumberStyleValue::create(0), NumberStyleValue::create(0), NumberStyleValue::create(0), NumberStyleValue::create(0));
+            return instance;
+        }
+    }
+
     return CSSRGB::create(
         NumberStyleValue::create(color.red()),
         NumberStyleValue::create(color.green()),
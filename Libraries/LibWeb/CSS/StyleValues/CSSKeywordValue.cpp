@@ -16,6 +16,19 @@
 
 namespace Web::CSS {
 
+ValueComparingNonnullRefPtr<CSSKeywordValue> CSSKeywordValue::create(Keyword keyword)
+{
+    // NOTE: We'll have to be much more careful with caching once we expose CSSKeywordValue to JS, as it's mutable.
+    // OPTIMIZATION: Keywords are by far the most common values in style sheets, so we only ever create one instance of each.
+    static Vector<RefPtr<CSSKeywordValue>> instances;
+    auto index = to_underlying(keyword);
+    if (index >= instances.size())
+        instances.resize(index + 1);
+    if (!instances[index])
+        instances[index] = adopt_ref(*new (nothrow) CSSKeywordValue(keyword));
+    return *instances[index];
+}
+
 String CSSKeywordValue::to_string(SerializationMode) const
 {
     return MUST(String::from_utf8(string_from_keyword(keyword())));
@@ -8,20 +8,24 @@
  */
 
 #include "LengthStyleValue.h"
+#include <AK/Array.h>
+#include <math.h>
 
 namespace Web::CSS {
 
 ValueComparingNonnullRefPtr<LengthStyleValue> LengthStyleValue::create(Length const& length)
 {
     VERIFY(!length.is_auto());
+    // OPTIMIZATION: Small whole pixel lengths (borders, paddings, margins...) are very common, so share an instance of each of them.
+    static constexpr size_t shared_px_instance_count = 33;
     if (length.is_px()) {
-        if (length.raw_value() == 0) {
-            static auto value = adopt_ref(*new (nothrow) LengthStyleValue(CSS::Length::make_px(0)));
-            return value;
-        }
-        if (length.raw_value() == 1) {
-            static auto value = adopt_ref(*new (nothrow) LengthStyleValue(CSS::Length::make_px(1)));
-            return value;
+        auto raw_value = length.raw_value();
+        if (raw_value >= 0 && raw_value < shared_px_instance_count && !signbit(raw_value) && raw_value == static_cast<double>(static_cast<size_t>(raw_value))) {
+            static Array<RefPtr<LengthStyleValue>, shared_px_instance_count> instances;
+            auto& instance = instances[static_cast<size_t>(raw_value)];
+            if (!instance)
+                instance = adopt_ref(*new (nothrow) LengthStyleValue(CSS::Length::make_px(raw_value)));
+            return *instance;
         }
     }
     return adopt_ref(*new (nothrow) LengthStyleValue(length));
@@ -8,9 +8,26 @@
  */
 
 #include "NumberStyleValue.h"
+#include <AK/Array.h>
+#include <math.h>
 
 namespace Web::CSS {
 
+ValueComparingNonnullRefPtr<NumberStyleValue> NumberStyleValue::create(double value)
+{
+    // OPTIMIZATION: Small non-negative integers (color channels, opacity, flex factors, line-height...) are very common,
+    //               so share an instance of each of them. Negative zero is left alone, as it serializes differently.
+    static constexpr size_t shared_instance_count = 256;
+    if (value >= 0 && value < shared_instance_count && !signbit(value) && value == static_cast<double>(static_cast<size_t>(value))) {
+        static Array<RefPtr<NumberStyleValue>, shared_instance_count> instances;
+        auto& instance = instances[static_cast<size_t>(value)];
+        if (!instance)
+            instance = adopt_ref(*new (nothrow) NumberStyleValue(value));
+        return *instance;
+    }
+    return adopt_ref(*new (nothrow) NumberStyleValue(value));
+}
+
 String NumberStyleValue::to_string(SerializationMode) const
 {
     return String::number(m_value);
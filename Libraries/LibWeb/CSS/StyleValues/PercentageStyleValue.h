@@ -18,6 +18,15 @@ class PercentageStyleValue final : public CSSUnitValue {
 public:
     static ValueComparingNonnullRefPtr<PercentageStyleValue> create(Percentage percentage)
     {
+        // OPTIMIZATION: Share instances of the most common percentages.
+        if (percentage.value() == 100) {
+            static auto const instance = adopt_ref(*new (nothrow) PercentageStyleValue(Percentage(100)));
+            return instance;
+        }
+        if (percentage.value() == 50) {
+            static auto const instance = adopt_ref(*new (nothrow) PercentageStyleValue(Percentage(50)));
+            return instance;
+        }
         return adopt_ref(*new (nothrow) PercentageStyleValue(move(percentage)));
     }
     virtual ~PercentageStyleValue() override = default;
@@ -139,6 +139,7 @@
 #include <LibWeb/Layout/Viewport.h>
 #include <LibWeb/Namespace.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Page/RenderingTrace.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
 #include <LibWeb/ResizeObserver/ResizeObserver.h>
@@ -467,6 +468,26 @@ Document::~Document()
     HTML::main_thread_event_loop().unregister_document({}, *this);
 }
 
+Optional<CSS::SelectorList> Document::parse_selector_with_cache(StringView selector_text) const
+{
+    static constexpr size_t max_parsed_selector_cache_size = 64;
+
+    auto key = MUST(String::from_utf8(selector_text));
+    if (auto it = m_parsed_selector_cache.find(key); it != m_parsed_selector_cache.end()) {
+        // Move the entry to the back, so that the front is always the least recently used one.
+        auto selectors = move(it->value);
+        m_parsed_selector_cache.remove(it);
+        m_parsed_selector_cache.set(move(key), selectors);
+        return selectors;
+    }
+
+    auto selectors = parse_selector(CSS::Parser::ParsingParams { *this }, selector_text);
+    if (m_parsed_selector_cache.size() >= max_parsed_selector_cache_size)
+        m_parsed_selector_cache.remove(m_parsed_selector_cache.begin());
+    m_parsed_selector_cache.set(move(key), selectors);
+    return selectors;
+}
+
 void Document::initialize(JS::Realm& realm)
 {
     Base::initialize(realm);
@@ -509,6 +530,7 @@ void Document::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_page);
     visitor.visit(m_window);
     visitor.visit(m_layout_root);
+    m_element_by_id_map.visit_edges(visitor);
     visitor.visit(m_style_sheets);
     visitor.visit(m_hovered_node);
     visitor.visit(m_inspected_node);
@@ -1183,8 +1205,23 @@ Optional<String> Document::encoding_parse_and_serialize_url(StringView url) cons
     return parsed_url->serialize();
 }
 
-void Document::set_needs_layout()
+void Document::set_needs_layout(SetNeedsLayoutReason reason)
 {
+    // NOTE: Without a more specific node to blame, nothing cached on the layout boxes can be trusted.
+    //       The caches are dropped by the next layout, which walks the whole tree anyway.
+    m_needs_intrinsic_size_reset = true;
+    if (auto* rendering_trace = page().rendering_trace())
+        rendering_trace->did_set_needs_layout(reason);
+    if (m_needs_layout)
+        return;
+    m_needs_layout = true;
+    schedule_layout_update();
+}
+
+void Document::did_mark_layout_node_as_needing_layout(Badge<Layout::Node>, SetNeedsLayoutReason reason)
+{
+    if (auto* rendering_trace = page().rendering_trace())
+        rendering_trace->did_set_needs_layout(reason);
     if (m_needs_layout)
         return;
     m_needs_layout = true;
@@ -1250,6 +1287,19 @@ static void propagate_overflow_to_viewport(Element& root_element, Layout::Viewpo
     overflow_origin_computed_values.set_overflow_y(CSS::Overflow::Visible);
 }
 
+void Document::update_layout_for_node(Node const& node)
+{
+    // AD-HOC: Ancestors with content-visibility: auto that aren't relevant to the user leave their contents out of the
+    //         layout tree. Treat them as relevant until the next rendering update, which either keeps them that way
+    //         (e.g. because the node was just scrolled into view) or skips their contents again.
+    for (auto* ancestor = node.parent_or_shadow_host_element(); ancestor; ancestor = ancestor->parent_or_shadow_host_element()) {
+        if (ancestor->contents_are_skipped_in_layout_tree())
+            const_cast<Element&>(*ancestor).make_relevant_to_the_user_until_next_rendering_update();
+    }
+
+    update_layout();
+}
+
 void Document::update_layout()
 {
     auto navigable = this->navigable();
@@ -1276,6 +1326,7 @@ void Document::update_layout()
     auto viewport_rect = navigable->viewport_rect();
 
     if (!m_layout_root || needs_layout_tree_update() || child_needs_layout_tree_update() || needs_full_layout_tree_update()) {
+        RenderingTrace::PhaseTimer trace_timer { page().rendering_trace(), RenderingPhase::LayoutTreeBuild };
         Layout::TreeBuilder tree_builder;
         m_layout_root = as<Layout::Viewport>(*tree_builder.build(*this));
 
@@ -1287,6 +1338,20 @@ void Document::update_layout()
         set_needs_full_layout_tree_update(false);
     }
 
+    RenderingTrace::PhaseTimer trace_timer { page().rendering_trace(), RenderingPhase::Layout };
+
+    u32 next_layout_index = 0;
+    m_layout_root->for_each_in_inclusive_subtree([&](auto& node) {
+        node.set_layout_index({}, next_layout_index++);
+        if (m_needs_intrinsic_size_reset) {
+            if (auto* box = as_if<Layout::Box>(node))
+                box->reset_intrinsic_sizes();
+        }
+        return TraversalDecision::Continue;
+    });
+    m_needs_intrinsic_size_reset = false;
+    trace_timer.set_item_count(next_layout_index);
+
     // Assign each box that establishes a formatting context a list of absolutely positioned children it should take care of during layout
     m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
         child.clear_contained_abspos_children();
@@ -1376,16 +1441,30 @@ void Document::update_layout()
     bool is_display_none = false;
 
     if (is<Element>(node)) {
+        auto& element = static_cast<Element&>(node);
+        CSS::RequiredInvalidationAfterStyleChange element_invalidation;
         if (needs_full_style_update || node.needs_style_update()) {
-            invalidation |= static_cast<Element&>(node).recompute_style();
+            node.document().increment_style_recomputation_count();
+            element_invalidation = element.recompute_style();
         } else if (needs_inherited_style_update) {
-            invalidation |= static_cast<Element&>(node).recompute_inherited_style();
+            element_invalidation = element.recompute_inherited_style();
         }
-        is_display_none = static_cast<Element&>(node).computed_properties()->display().is_none();
+        is_display_none = element.computed_properties()->display().is_none();
+
+        // NOTE: Elements with a layout node mark it as needing layout themselves. A display: contents element
+        //       doesn't have one, so we can't tell which part of the layout tree is affected.
+        if (element_invalidation.relayout && !element_invalidation.rebuild_layout_tree && element.computed_properties()->display().is_contents())
+            node.document().set_needs_layout(SetNeedsLayoutReason::StyleChange);
+        if (element_invalidation.rebuild_layout_tree)
+            element.invalidate_layout_tree_for_style_change();
+        invalidation |= element_invalidation;
     }
     node.set_needs_style_update(false);
 
     bool children_need_inherited_style_update = !invalidation.is_none();
+
+    // NOTE: Elements have already scheduled the layout tree rebuilds they need above.
+    invalidation.rebuild_layout_tree = false;
     if (needs_full_style_update || node.child_needs_style_update() || children_need_inherited_style_update) {
         if (node.is_element()) {
             if (auto shadow_root = static_cast<DOM::Element&>(node).shadow_root()) {
@@ -1459,6 +1538,9 @@ void Document::update_style()
     if (!needs_full_style_update() && !needs_style_update() && !child_needs_style_update())
         return;
 
+    RenderingTrace::PhaseTimer trace_timer { page().rendering_trace(), RenderingPhase::Style };
+    auto style_recomputation_count_before_update = m_style_recomputation_count;
+
     perform_pending_style_invalidations(*this, false);
 
     // NOTE: If this is a document hosting <template> contents, style update is unnecessary.
@@ -1479,12 +1561,12 @@ void Document::update_style()
     if (invalidation.rebuild_layout_tree) {
         invalidate_layout_tree();
     } else {
-        if (invalidation.relayout)
-            set_needs_layout();
         if (invalidation.rebuild_stacking_context_tree)
             invalidate_stacking_context_tree();
     }
     m_needs_full_style_update = false;
+
+    trace_timer.set_item_count(m_style_recomputation_count - style_recomputation_count_before_update);
 }
 
 void Document::update_animated_style_if_needed()
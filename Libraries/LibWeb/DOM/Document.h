@@ -23,8 +23,10 @@
 #include <LibURL/URL.h>
 #include <LibUnicode/Forward.h>
 #include <LibWeb/CSS/CSSStyleSheet.h>
+#include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/StyleSheetList.h>
 #include <LibWeb/Cookie/Cookie.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/DOM/NonElementParentNode.h>
 #include <LibWeb/DOM/ParentNode.h>
 #include <LibWeb/HTML/BrowsingContext.h>
@@ -118,6 +120,10 @@ public:
     u64 character_data_version() const { return m_character_data_version; }
     void bump_character_data_version() { ++m_character_data_version; }
 
+    // Parses a selector for querySelector() and friends. Scripts tend to pass the same few strings over and over,
+    // so the most recently used results (including failures) are cached.
+    Optional<CSS::SelectorList> parse_selector_with_cache(StringView selector_text) const;
+
     WebIDL::ExceptionOr<void> populate_with_html_head_and_body();
 
     GC::Ptr<Selection::Selection> get_selection() const;
@@ -256,10 +262,14 @@ public:
 
     void update_style();
     void update_layout();
+    // Like update_layout(), but first makes sure the node isn't left out of the layout tree by a content-visibility: auto
+    // ancestor, so that layout-dependent APIs and scrolling can use its boxes.
+    void update_layout_for_node(Node const&);
     void update_paint_and_hit_testing_properties_if_needed();
     void update_animated_style_if_needed();
 
-    void set_needs_layout();
+    void set_needs_layout(SetNeedsLayoutReason);
+    void did_mark_layout_node_as_needing_layout(Badge<Layout::Node>, SetNeedsLayoutReason);
 
     void invalidate_layout_tree();
     void invalidate_stacking_context_tree();
@@ -508,6 +518,10 @@ public:
     bool needs_full_style_update() const { return m_needs_full_style_update; }
     void set_needs_full_style_update(bool b) { m_needs_full_style_update = b; }
 
+    // Number of times an element in this document had its style fully recomputed. Used to test style invalidation.
+    u64 style_recomputation_count() const { return m_style_recomputation_count; }
+    void increment_style_recomputation_count() { ++m_style_recomputation_count; }
+
     [[nodiscard]] bool needs_full_layout_tree_update() const { return m_needs_full_layout_tree_update; }
     void set_needs_full_layout_tree_update(bool b) { m_needs_full_layout_tree_update = b; }
 
@@ -666,6 +680,9 @@ public:
     GC::Ptr<HTML::SessionHistoryEntry> latest_entry() const { return m_latest_entry; }
     void set_latest_entry(GC::Ptr<HTML::SessionHistoryEntry> e) { m_latest_entry = e; }
 
+    GC::Ptr<Element> get_element_by_id(FlyString const& id) const { return m_element_by_id_map.get(id); }
+    ElementByIdMap& element_by_id_map() { return m_element_by_id_map; }
+
     void element_id_changed(Badge<DOM::Element>, GC::Ref<DOM::Element> element);
     void element_with_id_was_added(Badge<DOM::Element>, GC::Ref<DOM::Element> element);
     void element_with_id_was_removed(Badge<DOM::Element>, GC::Ref<DOM::Element> element);
@@ -901,6 +918,10 @@ private:
 
     QuirksMode m_quirks_mode { QuirksMode::No };
 
+    mutable OrderedHashMap<String, Optional<CSS::SelectorList>> m_parsed_selector_cache;
+
+    ElementByIdMap m_element_by_id_map;
+
     // https://dom.spec.whatwg.org/#concept-document-type
     Type m_type { Type::XML };
 
@@ -968,8 +989,10 @@ private:
     Vector<WeakPtr<CSS::MediaQueryList>> m_media_query_lists;
 
     bool m_needs_layout { false };
+    bool m_needs_intrinsic_size_reset { false };
 
     bool m_needs_full_style_update { false };
+    u64 m_style_recomputation_count { 0 };
     bool m_needs_full_layout_tree_update { false };
 
     bool m_needs_animated_style_update { false };
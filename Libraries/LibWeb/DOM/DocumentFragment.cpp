@@ -6,6 +6,7 @@
 
 #include <LibWeb/Bindings/DocumentFragmentPrototype.h>
 #include <LibWeb/DOM/DocumentFragment.h>
+#include <LibWeb/DOM/ShadowRoot.h>
 #include <LibWeb/HTML/Window.h>
 
 namespace Web::DOM {
@@ -29,6 +30,14 @@ void DocumentFragment::visit_edges(Cell::Visitor& visitor)
     visitor.visit(m_host);
 }
 
+GC::Ptr<Element> DocumentFragment::get_element_by_id(FlyString const& id) const
+{
+    // Shadow trees keep an index of their ids, other fragments are searched the slow way.
+    if (auto const* shadow_root = as_if<ShadowRoot>(*this))
+        return shadow_root->element_by_id_map().get(id);
+    return NonElementParentNode::get_element_by_id(id);
+}
+
 void DocumentFragment::set_host(Web::DOM::Element* element)
 {
     m_host = element;
@@ -30,6 +30,8 @@ public:
 
     void set_host(Element*);
 
+    GC::Ptr<Element> get_element_by_id(FlyString const& id) const;
+
 protected:
     explicit DocumentFragment(Document& document);
 
@@ -510,7 +510,11 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style()
     m_affected_by_nth_child_pseudo_class = false;
 
     auto& style_computer = document().style_computer();
-    auto new_computed_properties = style_computer.compute_style(*this);
+    auto new_computed_properties = [&] -> GC::Ref<CSS::ComputedProperties> {
+        if (auto shared_computed_properties = style_computer.try_share_style_with_sibling(*this))
+            return *shared_computed_properties;
+        return style_computer.compute_style(*this);
+    }();
 
     // Tables must not inherit -libweb-* values for text-align.
     // FIXME: Find the spec for this.
@@ -565,6 +569,8 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style()
     if (!invalidation.rebuild_layout_tree && layout_node()) {
         // If we're keeping the layout tree, we can just apply the new style to the existing layout tree.
         layout_node()->apply_style(*m_computed_properties);
+        if (invalidation.relayout)
+            layout_node()->invalidate_layout(SetNeedsLayoutReason::StyleChange);
         if (invalidation.repaint && paintable())
             paintable()->set_needs_display();
 
@@ -581,6 +587,8 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style()
 
             if (auto* node_with_style = dynamic_cast<Layout::NodeWithStyle*>(pseudo_element->layout_node.ptr())) {
                 node_with_style->apply_style(*pseudo_element_style);
+                if (invalidation.relayout)
+                    node_with_style->invalidate_layout(SetNeedsLayoutReason::StyleChange);
                 if (invalidation.repaint && node_with_style->first_paintable())
                     node_with_style->first_paintable()->set_needs_display();
             }
@@ -619,6 +627,8 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_inherited_style()
     document().style_computer().absolutize_values(*computed_properties);
 
     layout_node()->apply_style(*computed_properties);
+    if (invalidation.relayout)
+        layout_node()->invalidate_layout(SetNeedsLayoutReason::StyleChange);
     return invalidation;
 }
 
@@ -765,7 +775,7 @@ GC::Ptr<ShadowRoot> Element::shadow_root_for_bindings() const
 WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams(document()), selectors);
+    auto maybe_selectors = document().parse_selector_with_cache(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -785,7 +795,7 @@ WebIDL::ExceptionOr<bool> Element::matches(StringView selectors) const
 WebIDL::ExceptionOr<DOM::Element const*> Element::closest(StringView selectors) const
 {
     // 1. Let s be the result of parse a selector from selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams(document()), selectors);
+    auto maybe_selectors = document().parse_selector_with_cache(selectors);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -971,7 +981,7 @@ GC::Ref<Geometry::DOMRectList> Element::get_client_rects() const
         return Geometry::DOMRectList::create(realm(), {});
 
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document()).update_layout();
+    const_cast<Document&>(document()).update_layout_for_node(*this);
 
     // 1. If the element on which it was invoked does not have an associated layout box return an empty DOMRectList
     //    object and stop this algorithm.
@@ -1024,7 +1034,7 @@ GC::Ref<Geometry::DOMRectList> Element::get_client_rects() const
 int Element::client_top() const
 {
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document()).update_layout();
+    const_cast<Document&>(document()).update_layout_for_node(*this);
 
     // 1. If the element has no associated CSS layout box or if the CSS layout box is inline, return zero.
     if (!paintable_box())
@@ -1040,7 +1050,7 @@ int Element::client_top() const
 int Element::client_left() const
 {
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document()).update_layout();
+    const_cast<Document&>(document()).update_layout_for_node(*this);
 
     // 1. If the element has no associated CSS layout box or if the CSS layout box is inline, return zero.
     if (!paintable_box())
@@ -1066,7 +1076,7 @@ int Element::client_width() const
     }
 
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document()).update_layout();
+    const_cast<Document&>(document()).update_layout_for_node(*this);
 
     // 1. If the element has no associated CSS layout box or if the CSS layout box is inline, return zero.
     if (!paintable_box())
@@ -1091,7 +1101,7 @@ int Element::client_height() const
     }
 
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document()).update_layout();
+    const_cast<Document&>(document()).update_layout_for_node(*this);
 
     // 1. If the element has no associated CSS layout box or if the CSS layout box is inline, return zero.
     if (!paintable_box())
@@ -1113,8 +1123,11 @@ void Element::inserted()
 {
     Base::inserted();
 
-    if (m_id.has_value())
+    if (m_id.has_value()) {
+        if (auto* element_by_id_map = ElementByIdMap::for_tree_root(root()))
+            element_by_id_map->add(*m_id, *this);
         document().element_with_id_was_added({}, *this);
+    }
 
     if (m_name.has_value())
         document().element_with_name_was_added({}, *this);
@@ -1124,8 +1137,13 @@ void Element::removed_from(Node* old_parent, Node& old_root)
 {
     Base::removed_from(old_parent, old_root);
 
-    if (m_id.has_value())
+    if (m_id.has_value()) {
+        // NOTE: Elements in a shadow tree that moved along with its host are also told about old_root,
+        //       but they were never in its map, so removing them is a no-op.
+        if (auto* element_by_id_map = ElementByIdMap::for_tree_root(old_root))
+            element_by_id_map->remove(*m_id, *this);
         document().element_with_id_was_removed({}, *this);
+    }
 
     if (m_name.has_value())
         document().element_with_name_was_removed({}, *this);
@@ -1441,7 +1459,7 @@ double Element::scroll_top() const
         return window->scroll_y();
 
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document).update_layout();
+    const_cast<Document&>(document).update_layout_for_node(*this);
 
     // 7. If the element is the body element, document is in quirks mode, and the element is not potentially scrollable, return the value of scrollY on window.
     if (document.body() == this && document.in_quirks_mode() && !is_potentially_scrollable())
@@ -1483,7 +1501,7 @@ double Element::scroll_left() const
         return window->scroll_x();
 
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document).update_layout();
+    const_cast<Document&>(document).update_layout_for_node(*this);
 
     // 7. If the element is the body element, document is in quirks mode, and the element is not potentially scrollable, return the value of scrollX on window.
     if (document.body() == this && document.in_quirks_mode() && !is_potentially_scrollable())
@@ -1532,7 +1550,7 @@ void Element::set_scroll_left(double x)
     }
 
     // NOTE: Ensure that layout is up-to-date before looking at metrics or scrolling the page.
-    const_cast<Document&>(document).update_layout();
+    const_cast<Document&>(document).update_layout_for_node(*this);
 
     // 9. If the element is the body element, document is in quirks mode, and the element is not potentially scrollable, invoke scroll() on window with x as first argument and scrollY on window as second argument, and terminate these steps.
     if (document.body() == this && document.in_quirks_mode() && !is_potentially_scrollable()) {
@@ -1589,7 +1607,7 @@ void Element::set_scroll_top(double y)
     }
 
     // NOTE: Ensure that layout is up-to-date before looking at metrics or scrolling the page.
-    const_cast<Document&>(document).update_layout();
+    const_cast<Document&>(document).update_layout_for_node(*this);
 
     // 9. If the element is the body element, document is in quirks mode, and the element is not potentially scrollable, invoke scroll() on window with scrollX as first argument and y as second argument, and terminate these steps.
     if (document.body() == this && document.in_quirks_mode() && !is_potentially_scrollable()) {
@@ -1634,7 +1652,7 @@ int Element::scroll_width() const
         return max(viewport_scroll_width, viewport_width);
 
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document).update_layout();
+    const_cast<Document&>(document).update_layout_for_node(*this);
 
     // 5. If the element is the body element, document is in quirks mode and the element is not potentially scrollable,
     //    return max(viewport scrolling area width, viewport width).
@@ -1673,7 +1691,7 @@ int Element::scroll_height() const
         return max(viewport_scroll_height, viewport_height);
 
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<Document&>(document).update_layout();
+    const_cast<Document&>(document).update_layout_for_node(*this);
 
     // 5. If the element is the body element, document is in quirks mode and the element is not potentially scrollable,
     //    return max(viewport scrolling area height, viewport height).
@@ -2155,7 +2173,7 @@ ErrorOr<void> Element::scroll_into_view(Optional<Variant<bool, ScrollIntoViewOpt
     }
 
     // 7. If the element does not have any associated box, or is not available to user-agent features, then return.
-    document().update_layout();
+    document().update_layout_for_node(*this);
     if (!layout_node())
         return Error::from_string_literal("Element has no associated box");
 
@@ -2934,8 +2952,10 @@ void Element::determine_proximity_to_the_viewport()
     // viewport soon. A margin of 50% is suggested as a reasonable default.
     viewport_rect.inflate(viewport_rect.width(), viewport_rect.height());
     // FIXME: We don't have paint containment or the overflow clip edge yet, so this is just using the absolute rect for now.
-    if (paintable_box()->absolute_rect().intersects(viewport_rect))
+    if (paintable_box()->absolute_rect().intersects(viewport_rect)) {
         m_proximity_to_the_viewport = ProximityToTheViewport::CloseToTheViewport;
+        return;
+    }
 
     // FIXME: If a filter (see [FILTER-EFFECTS-1]) with non local effects includes the element as part of its input, the user
     //        agent should also treat the element as relevant to the user when the filter’s output can affect the rendering
@@ -2970,24 +2990,32 @@ bool Element::is_relevant_to_the_user()
         return true;
 
     // Either the element or its contents are placed in the top layer.
-    bool is_in_top_layer = false;
-    for_each_in_inclusive_subtree_of_type<Element>([&](auto& element) {
-        if (element.in_top_layer()) {
-            is_in_top_layer = true;
-            return TraversalDecision::Break;
-        }
-
-        return TraversalDecision::Continue;
-    });
-    if (is_in_top_layer)
-        return true;
+    // NOTE: The top layer is usually empty, so we check its elements instead of walking our whole subtree.
+    for (auto const& top_layer_element : document().top_layer_elements()) {
+        if (is_inclusive_ancestor_of(top_layer_element))
+            return true;
+    }
 
     // FIXME: The element has a flat tree descendant that is captured in a view transition.
 
+    // AD-HOC: A layout-dependent API or scrolling needed the element's contents since the last rendering update.
+    if (m_is_relevant_to_the_user_until_next_rendering_update)
+        return true;
+
     // NOTE: none of the above conditions are true, so the element is not relevant to the user.
     return false;
 }
 
+void Element::make_relevant_to_the_user_until_next_rendering_update()
+{
+    if (m_is_relevant_to_the_user_until_next_rendering_update)
+        return;
+    if (!computed_properties() || computed_properties()->content_visibility() != CSS::ContentVisibility::Auto)
+        return;
+    m_is_relevant_to_the_user_until_next_rendering_update = true;
+    set_needs_layout_tree_update(true);
+}
+
 // https://drafts.csswg.org/css-contain-2/#skips-its-contents
 bool Element::skips_its_contents()
 {
@@ -3005,6 +3033,42 @@ bool Element::skips_its_contents()
     return false;
 }
 
+void Element::invalidate_layout_tree_for_style_change()
+{
+    // NOTE: The root element and body propagate some of their style to the viewport, elements in the top layer are
+    //       laid out as children of the viewport, and SVG masks and clip paths get a layout subtree for each use.
+    if (is_document_element() || is_html_body_element() || rendered_in_top_layer() || is_svg_element()) {
+        document().invalidate_layout_tree();
+        return;
+    }
+
+    // The boxes this element generates decide which anonymous boxes get wrapped around it and its siblings, so we
+    // rebuild the layout subtree of an ancestor that contains all of them. Inline boxes may have been split around
+    // block-level descendants, and table parts have anonymous table boxes around them, so those don't qualify.
+    for (auto* ancestor = parent_or_shadow_host_element(); ancestor; ancestor = ancestor->parent_or_shadow_host_element()) {
+        auto const* layout_node = ancestor->layout_node();
+        if (!layout_node) {
+            auto ancestor_properties = ancestor->computed_properties();
+            if (ancestor_properties && ancestor_properties->display().is_contents())
+                continue;
+
+            // The ancestor doesn't generate a box, so neither does this element.
+            return;
+        }
+
+        auto display = layout_node->display();
+        if ((display.is_inline_outside() && display.is_flow_inside()) || display.is_internal())
+            continue;
+
+        // NOTE: Marking this element as well keeps the tree builder from reusing the layout subtree it's in.
+        set_needs_layout_tree_update(true);
+        ancestor->set_needs_layout_tree_update(true);
+        return;
+    }
+
+    document().invalidate_layout_tree();
+}
+
 // https://drafts.csswg.org/css-contain-2/#containment-size
 bool Element::has_size_containment() const
 {
@@ -3404,11 +3468,18 @@ void Element::attribute_changed(FlyString const& local_name, Optional<String> co
     auto value_or_empty = value.value_or(String {});
 
     if (local_name == HTML::AttributeNames::id) {
+        auto* element_by_id_map = ElementByIdMap::for_tree_root(root());
+        if (element_by_id_map && m_id.has_value())
+            element_by_id_map->remove(*m_id, *this);
+
         if (value_or_empty.is_empty())
             m_id = {};
         else
             m_id = value_or_empty;
 
+        if (element_by_id_map && m_id.has_value())
+            element_by_id_map->add(*m_id, *this);
+
         document().element_id_changed({}, *this);
     } else if (local_name == HTML::AttributeNames::name) {
         if (value_or_empty.is_empty())
@@ -414,6 +414,19 @@ public:
     // https://drafts.csswg.org/css-contain-2/#skips-its-contents
     bool skips_its_contents();
 
+    // Whether the layout tree was last built without this element's contents, because it skipped its contents.
+    bool contents_are_skipped_in_layout_tree() const { return m_contents_are_skipped_in_layout_tree; }
+    void set_contents_are_skipped_in_layout_tree(Badge<Layout::TreeBuilder>, bool value) { m_contents_are_skipped_in_layout_tree = value; }
+
+    // AD-HOC: Used when layout-dependent APIs or scrolling need boxes for this element's contents while it has
+    //         content-visibility: auto. Cleared when the rendering update next determines proximity to the viewport.
+    void make_relevant_to_the_user_until_next_rendering_update();
+    void clear_relevance_until_next_rendering_update(Badge<HTML::EventLoop>) { m_is_relevant_to_the_user_until_next_rendering_update = false; }
+
+    // Called when a style change affects which boxes this element generates. Schedules a rebuild of the smallest part
+    // of the layout tree that contains those boxes, falling back to rebuilding the whole layout tree.
+    void invalidate_layout_tree_for_style_change();
+
     // https://drafts.csswg.org/css-contain-2/#containment-types
     bool has_size_containment() const;
     bool has_inline_size_containment() const;
@@ -556,6 +569,8 @@ private:
 
     // https://drafts.csswg.org/css-contain/#proximity-to-the-viewport
     ProximityToTheViewport m_proximity_to_the_viewport { ProximityToTheViewport::NotDetermined };
+    bool m_contents_are_skipped_in_layout_tree { false };
+    bool m_is_relevant_to_the_user_until_next_rendering_update { false };
 };
 
 template<>
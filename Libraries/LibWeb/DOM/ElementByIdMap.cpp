@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/DOM/Document.h>
+#include <LibWeb/DOM/Element.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
+#include <LibWeb/DOM/ShadowRoot.h>
+
+namespace Web::DOM {
+
+ElementByIdMap* ElementByIdMap::for_tree_root(Node& root)
+{
+    if (auto* document = as_if<Document>(root))
+        return &document->element_by_id_map();
+    if (auto* shadow_root = as_if<ShadowRoot>(root))
+        return &shadow_root->element_by_id_map();
+    return nullptr;
+}
+
+void ElementByIdMap::add(FlyString const& id, Element& element)
+{
+    auto& elements = m_elements_by_id.ensure(id);
+
+    // NOTE: Most ids are unique, so only elements sharing an id pay for keeping the list in tree order.
+    if (elements.is_empty()) {
+        elements.append(element);
+        return;
+    }
+
+    for (auto const& existing_element : elements) {
+        if (existing_element.ptr() == &element)
+            return;
+    }
+
+    auto index = elements.find_first_index_if([&](auto const& existing_element) {
+        return element.compare_document_position(existing_element) & Node::DOCUMENT_POSITION_FOLLOWING;
+    });
+    if (index.has_value())
+        elements.insert(index.value(), element);
+    else
+        elements.append(element);
+}
+
+void ElementByIdMap::remove(FlyString const& id, Element& element)
+{
+    auto it = m_elements_by_id.find(id);
+    if (it == m_elements_by_id.end())
+        return;
+
+    it->value.remove_first_matching([&](auto const& existing_element) { return existing_element.ptr() == &element; });
+    if (it->value.is_empty())
+        m_elements_by_id.remove(it);
+}
+
+GC::Ptr<Element> ElementByIdMap::get(FlyString const& id) const
+{
+    auto it = m_elements_by_id.find(id);
+    if (it == m_elements_by_id.end())
+        return nullptr;
+    return it->value.first();
+}
+
+void ElementByIdMap::visit_edges(GC::Cell::Visitor& visitor)
+{
+    for (auto& it : m_elements_by_id)
+        visitor.visit(it.value);
+}
+
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/FlyString.h>
+#include <AK/HashMap.h>
+#include <AK/Vector.h>
+#include <LibGC/Cell.h>
+#include <LibGC/Ptr.h>
+#include <LibWeb/Forward.h>
+
+namespace Web::DOM {
+
+// Maps ids to the elements of one tree (a document or a shadow tree) that have them, in tree order.
+class ElementByIdMap {
+public:
+    // Returns the map kept by the given tree root, or null if it's a root that doesn't keep one (e.g. a detached element).
+    static ElementByIdMap* for_tree_root(Node&);
+    static ElementByIdMap const* for_tree_root(Node const& root) { return for_tree_root(const_cast<Node&>(root)); }
+
+    void add(FlyString const& id, Element&);
+    void remove(FlyString const& id, Element&);
+
+    GC::Ptr<Element> get(FlyString const& id) const;
+
+    void visit_edges(GC::Cell::Visitor&);
+
+private:
+    HashMap<FlyString, Vector<GC::Ref<Element>>> m_elements_by_id;
+};
+
+}
@@ -53,6 +53,8 @@
 #include <LibWeb/Layout/TextNode.h>
 #include <LibWeb/MathML/MathMLElement.h>
 #include <LibWeb/Namespace.h>
+#include <LibWeb/Page/Page.h>
+#include <LibWeb/Page/RenderingTrace.h>
 #include <LibWeb/Painting/Paintable.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/SVG/SVGElement.h>
@@ -385,7 +387,7 @@ GC::Ptr<HTML::Navigable> Node::navigable() const
     return navigable;
 }
 
-[[maybe_unused]] static StringView to_string(StyleInvalidationReason reason)
+StringView to_string(StyleInvalidationReason reason)
 {
 #define __ENUMERATE_STYLE_INVALIDATION_REASON(reason) \
     case StyleInvalidationReason::reason:             \
@@ -395,6 +397,20 @@ GC::Ptr<HTML::Navigable> Node::navigable() const
     default:
         VERIFY_NOT_REACHED();
     }
+#undef __ENUMERATE_STYLE_INVALIDATION_REASON
+}
+
+StringView to_string(SetNeedsLayoutReason reason)
+{
+#define __ENUMERATE_SET_NEEDS_LAYOUT_REASON(reason) \
+    case SetNeedsLayoutReason::reason:              \
+        return #reason##sv;
+    switch (reason) {
+        ENUMERATE_SET_NEEDS_LAYOUT_REASONS(__ENUMERATE_SET_NEEDS_LAYOUT_REASON)
+    default:
+        VERIFY_NOT_REACHED();
+    }
+#undef __ENUMERATE_SET_NEEDS_LAYOUT_REASON
 }
 
 void Node::invalidate_style(StyleInvalidationReason reason)
@@ -402,7 +418,17 @@ void Node::invalidate_style(StyleInvalidationReason reason)
     if (is_character_data())
         return;
 
-    if (document().style_computer().may_have_has_selectors()) {
+    if (auto* rendering_trace = document().page().rendering_trace())
+        rendering_trace->did_invalidate_style(reason);
+
+    auto& style_computer = document().style_computer();
+    bool may_affect_has_selectors = style_computer.may_have_has_selectors();
+    // NOTE: Inserting or removing a subtree can only change the result of a :has() if something inside it is mentioned
+    //       by a :has() argument, unless some :has() argument can be matched without mentioning anything in particular.
+    if (may_affect_has_selectors && (reason == StyleInvalidationReason::NodeInsertBefore || reason == StyleInvalidationReason::NodeRemove))
+        may_affect_has_selectors = style_computer.may_affect_has_selectors_when_inserted_or_removed(*this);
+
+    if (may_affect_has_selectors) {
         if (reason == StyleInvalidationReason::NodeRemove) {
             if (auto* parent = parent_or_shadow_host(); parent) {
                 document().schedule_ancestors_style_invalidation_due_to_presence_of_has(*parent);
@@ -466,11 +492,14 @@ void Node::invalidate_style(StyleInvalidationReason reason)
     document().schedule_style_update();
 }
 
-void Node::invalidate_style(StyleInvalidationReason, Vector<CSS::InvalidationSet::Property> const& properties, StyleInvalidationOptions options)
+void Node::invalidate_style(StyleInvalidationReason reason, Vector<CSS::InvalidationSet::Property> const& properties, StyleInvalidationOptions options)
 {
     if (is_character_data())
         return;
 
+    if (auto* rendering_trace = document().page().rendering_trace())
+        rendering_trace->did_invalidate_style(reason);
+
     bool properties_used_in_has_selectors = false;
     for (auto const& property : properties) {
         properties_used_in_has_selectors |= document().style_computer().invalidation_property_used_in_has_selector(property);
@@ -1379,10 +1408,18 @@ void Node::set_needs_layout_tree_update(bool value)
                 break;
             ancestor->m_child_needs_layout_tree_update = true;
         }
-        document().set_needs_layout();
+        document().set_needs_layout(SetNeedsLayoutReason::LayoutTreeUpdate);
     }
 }
 
+void Node::invalidate_layout(SetNeedsLayoutReason reason)
+{
+    if (auto* layout_node = this->layout_node())
+        layout_node->invalidate_layout(reason);
+    else
+        document().set_needs_layout(reason);
+}
+
 void Node::set_needs_style_update(bool value)
 {
     if (m_needs_style_update == value)
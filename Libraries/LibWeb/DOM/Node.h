@@ -103,6 +103,28 @@ enum class StyleInvalidationReason {
 #undef __ENUMERATE_STYLE_INVALIDATION_REASON
 };
 
+StringView to_string(StyleInvalidationReason);
+
+#define ENUMERATE_SET_NEEDS_LAYOUT_REASONS(X)         \
+    X(CharacterDataReplaceData)                       \
+    X(FinalizeACrossDocumentNavigation)               \
+    X(HTMLImageElementReactToChangesInTheEnvironment) \
+    X(HTMLImageElementUpdateTheImageData)             \
+    X(HTMLVideoElementSetVideoTrack)                  \
+    X(KeyframeEffect)                                 \
+    X(LayoutTreeUpdate)                               \
+    X(NavigableSetViewportSize)                       \
+    X(StyleChange)                                    \
+    X(SVGImageElementFetchTheDocument)
+
+enum class SetNeedsLayoutReason {
+#define __ENUMERATE_SET_NEEDS_LAYOUT_REASON(reason) reason,
+    ENUMERATE_SET_NEEDS_LAYOUT_REASONS(__ENUMERATE_SET_NEEDS_LAYOUT_REASON)
+#undef __ENUMERATE_SET_NEEDS_LAYOUT_REASON
+};
+
+StringView to_string(SetNeedsLayoutReason);
+
 class Node : public EventTarget
     , public TreeNode<Node> {
     WEB_PLATFORM_OBJECT(Node, EventTarget);
@@ -299,6 +321,9 @@ public:
     [[nodiscard]] bool child_needs_layout_tree_update() const { return m_child_needs_layout_tree_update; }
     void set_child_needs_layout_tree_update(bool b) { m_child_needs_layout_tree_update = b; }
 
+    // Invalidates the layout of this node's layout node, or of the whole document if it doesn't have one.
+    void invalidate_layout(SetNeedsLayoutReason);
+
     bool needs_style_update() const { return m_needs_style_update; }
     void set_needs_style_update(bool);
     void set_needs_style_update_internal(bool) { m_needs_style_update = true; }
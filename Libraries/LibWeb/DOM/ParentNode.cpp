@@ -47,12 +47,52 @@ enum class ReturnMatches {
     First,
     All,
 };
+
+// Selectors made of a single #id, .class or type selector are by far the most common ones passed to
+// querySelector(All), so we match them directly instead of going through the selector engine.
+static CSS::Selector::SimpleSelector const* single_simple_selector_for_fast_path(CSS::SelectorList const& selectors)
+{
+    if (selectors.size() != 1)
+        return nullptr;
+    auto const& compound_selectors = selectors.first()->compound_selectors();
+    if (compound_selectors.size() != 1 || compound_selectors.first().simple_selectors.size() != 1)
+        return nullptr;
+
+    auto const& simple_selector = compound_selectors.first().simple_selectors.first();
+    switch (simple_selector.type) {
+    case CSS::Selector::SimpleSelector::Type::Id:
+    case CSS::Selector::SimpleSelector::Type::Class:
+        return &simple_selector;
+    case CSS::Selector::SimpleSelector::Type::TagName:
+        if (simple_selector.qualified_name().namespace_type == CSS::Selector::SimpleSelector::QualifiedName::NamespaceType::Default)
+            return &simple_selector;
+        return nullptr;
+    default:
+        return nullptr;
+    }
+}
+
+static bool matches_simple_selector_fast_path(CSS::Selector::SimpleSelector const& simple_selector, Element const& element)
+{
+    switch (simple_selector.type) {
+    case CSS::Selector::SimpleSelector::Type::Id:
+        return simple_selector.name() == element.id();
+    case CSS::Selector::SimpleSelector::Type::Class:
+        return element.has_class(simple_selector.name(), element.document().in_quirks_mode() ? CaseSensitivity::CaseInsensitive : CaseSensitivity::CaseSensitive);
+    case CSS::Selector::SimpleSelector::Type::TagName:
+        if (element.namespace_uri() == Namespace::HTML && element.document().document_type() == Document::Type::HTML)
+            return simple_selector.qualified_name().name.lowercase_name == element.local_name();
+        return simple_selector.qualified_name().name.name == element.local_name();
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
 // https://dom.spec.whatwg.org/#scope-match-a-selectors-string
 static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_match_a_selectors_string(ParentNode& node, StringView selector_text, ReturnMatches return_matches)
 {
     // To scope-match a selectors string selectors against a node, run these steps:
     // 1. Let s be the result of parse a selector selectors.
-    auto maybe_selectors = parse_selector(CSS::Parser::ParsingParams { node.document() }, selector_text);
+    auto maybe_selectors = node.document().parse_selector_with_cache(selector_text);
 
     // 2. If s is failure, then throw a "SyntaxError" DOMException.
     if (!maybe_selectors.has_value())
@@ -68,20 +108,41 @@ static WebIDL::ExceptionOr<Variant<GC::Ptr<Element>, GC::Ref<NodeList>>> scope_m
     GC::Ptr<Element> single_result;
     Vector<GC::Root<Node>> results;
     // FIXME: This should be shadow-including. https://drafts.csswg.org/selectors-4/#match-a-selector-against-a-tree
-    node.for_each_in_subtree_of_type<Element>([&](auto& element) {
-        for (auto& selector : selectors) {
-            SelectorEngine::MatchContext context;
-            if (SelectorEngine::matches(selector, element, nullptr, context, {}, node)) {
-                if (return_matches == ReturnMatches::First) {
-                    single_result = &element;
-                    return TraversalDecision::Break;
+    if (auto const* simple_selector = single_simple_selector_for_fast_path(selectors)) {
+        // The first element with a given id in a document or shadow tree is indexed.
+        if (simple_selector->type == CSS::Selector::SimpleSelector::Type::Id && return_matches == ReturnMatches::First) {
+            if (auto* document = as_if<Document>(node))
+                return { document->get_element_by_id(simple_selector->name()) };
+            if (auto* shadow_root = as_if<ShadowRoot>(node))
+                return { shadow_root->element_by_id_map().get(simple_selector->name()) };
+        }
+
+        node.for_each_in_subtree_of_type<Element>([&](auto& element) {
+            if (!matches_simple_selector_fast_path(*simple_selector, element))
+                return TraversalDecision::Continue;
+            if (return_matches == ReturnMatches::First) {
+                single_result = &element;
+                return TraversalDecision::Break;
+            }
+            results.append(element);
+            return TraversalDecision::Continue;
+        });
+    } else {
+        node.for_each_in_subtree_of_type<Element>([&](auto& element) {
+            for (auto& selector : selectors) {
+                SelectorEngine::MatchContext context;
+                if (SelectorEngine::matches(selector, element, nullptr, context, {}, node)) {
+                    if (return_matches == ReturnMatches::First) {
+                        single_result = &element;
+                        return TraversalDecision::Break;
+                    }
+                    results.append(element);
+                    break;
                 }
-                results.append(element);
-                break;
             }
-        }
-        return TraversalDecision::Continue;
-    });
+            return TraversalDecision::Continue;
+        });
+    }
 
     if (return_matches == ReturnMatches::First)
         return { single_result };
@@ -136,6 +136,7 @@ void ShadowRoot::visit_edges(Visitor& visitor)
     Base::visit_edges(visitor);
     visitor.visit(m_style_sheets);
     visitor.visit(m_adopted_style_sheets);
+    m_element_by_id_map.visit_edges(visitor);
 }
 
 GC::Ref<WebIDL::ObservableArray> ShadowRoot::adopted_style_sheets() const
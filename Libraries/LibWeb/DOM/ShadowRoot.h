@@ -8,6 +8,7 @@
 
 #include <LibWeb/Bindings/ShadowRootPrototype.h>
 #include <LibWeb/DOM/DocumentFragment.h>
+#include <LibWeb/DOM/ElementByIdMap.h>
 #include <LibWeb/WebIDL/ObservableArray.h>
 
 namespace Web::DOM {
@@ -62,6 +63,9 @@ public:
 
     WebIDL::ExceptionOr<Vector<GC::Ref<Animations::Animation>>> get_animations();
 
+    ElementByIdMap& element_by_id_map() { return m_element_by_id_map; }
+    ElementByIdMap const& element_by_id_map() const { return m_element_by_id_map; }
+
     virtual void finalize() override;
 
 protected:
@@ -92,6 +96,8 @@ private:
 
     GC::Ptr<CSS::StyleSheetList> m_style_sheets;
     mutable GC::Ptr<WebIDL::ObservableArray> m_adopted_style_sheets;
+
+    ElementByIdMap m_element_by_id_map;
 };
 
 template<>
@@ -20,6 +20,7 @@ class LoadRequest;
 class Page;
 class PageClient;
 class PaintContext;
+class RenderingTrace;
 class Resource;
 class ResourceLoader;
 class XMLDocumentBuilder;
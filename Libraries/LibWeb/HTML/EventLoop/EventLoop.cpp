@@ -414,6 +414,10 @@ void EventLoop::update_the_rendering()
                         return TraversalDecision::Continue;
                     }
 
+                    // AD-HOC: Contents that layout-dependent APIs or scrolling needed since the last rendering update only stay
+                    //         relevant if the checks below agree.
+                    element.clear_relevance_until_next_rendering_update({});
+
                     // 1. Let checkForInitialDetermination be true if element's proximity to the viewport is not determined and it is not relevant to the user. Otherwise, let checkForInitialDetermination be false.
                     bool check_for_initial_determination = element.proximity_to_the_viewport() == Web::DOM::ProximityToTheViewport::NotDetermined && !element.is_relevant_to_the_user();
 
@@ -425,6 +429,11 @@ void EventLoop::update_the_rendering()
                         had_initial_visible_content_visibility_determination = true;
                     }
 
+                    // AD-HOC: The contents of elements that skip them are left out of the layout tree, so if that changed,
+                    //         they have to be added to or removed from it.
+                    if (element.skips_its_contents() != element.contents_are_skipped_in_layout_tree())
+                        element.set_needs_layout_tree_update(true);
+
                     return TraversalDecision::Continue;
                 });
             }
@@ -23,7 +23,16 @@ void TaskQueue::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_event_loop);
-    visitor.visit(m_tasks);
+    for (auto& task : pending_tasks())
+        visitor.visit(task);
+}
+
+void TaskQueue::discard_dequeued_tasks()
+{
+    if (m_first_pending_task == 0)
+        return;
+    m_tasks.remove(0, m_first_pending_task);
+    m_first_pending_task = 0;
 }
 
 void TaskQueue::add(GC::Ref<Task> task)
@@ -32,14 +41,32 @@ void TaskQueue::add(GC::Ref<Task> task)
     m_event_loop->schedule();
 }
 
+GC::Ptr<Task> TaskQueue::dequeue()
+{
+    if (m_tasks.is_empty())
+        return {};
+
+    auto task = m_tasks[m_first_pending_task++];
+    if (m_first_pending_task == m_tasks.size()) {
+        m_tasks.clear_with_capacity();
+        m_first_pending_task = 0;
+    } else if (m_first_pending_task > m_tasks.size() / 2) {
+        discard_dequeued_tasks();
+    }
+    return task;
+}
+
 GC::Ptr<Task> TaskQueue::take_first_runnable()
 {
     if (m_event_loop->execution_paused())
         return nullptr;
 
-    for (size_t i = 0; i < m_tasks.size(); ++i) {
-        if (m_tasks[i]->is_runnable())
-            return m_tasks.take(i);
+    for (size_t i = m_first_pending_task; i < m_tasks.size(); ++i) {
+        if (!m_tasks[i]->is_runnable())
+            continue;
+        if (i == m_first_pending_task)
+            return dequeue();
+        return m_tasks.take(i);
     }
     return nullptr;
 }
@@ -49,7 +76,7 @@ bool TaskQueue::has_runnable_tasks() const
     if (m_event_loop->execution_paused())
         return false;
 
-    for (auto& task : m_tasks) {
+    for (auto& task : pending_tasks()) {
         if (task->is_runnable())
             return true;
     }
@@ -58,6 +85,7 @@ bool TaskQueue::has_runnable_tasks() const
 
 void TaskQueue::remove_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
+    discard_dequeued_tasks();
     m_tasks.remove_all_matching([&](auto& task) {
         return filter(*task);
     });
@@ -66,6 +94,7 @@ void TaskQueue::remove_tasks_matching(Function<bool(HTML::Task const&)> filter)
 GC::RootVector<GC::Ref<Task>> TaskQueue::take_tasks_matching(Function<bool(HTML::Task const&)> filter)
 {
     GC::RootVector<GC::Ref<Task>> matching_tasks(heap());
+    discard_dequeued_tasks();
 
     for (size_t i = 0; i < m_tasks.size();) {
         auto& task = m_tasks.at(i);
@@ -90,7 +119,7 @@ Task const* TaskQueue::last_added_task() const
 
 bool TaskQueue::has_rendering_tasks() const
 {
-    for (auto const& task : m_tasks) {
+    for (auto const& task : pending_tasks()) {
         if (task->source() == Task::Source::Rendering)
             return true;
     }
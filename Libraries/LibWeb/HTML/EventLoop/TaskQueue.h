@@ -29,12 +29,7 @@ public:
     GC::Ptr<HTML::Task> take_first_runnable();
 
     void enqueue(GC::Ref<HTML::Task> task) { add(task); }
-    GC::Ptr<HTML::Task> dequeue()
-    {
-        if (m_tasks.is_empty())
-            return {};
-        return m_tasks.take_first();
-    }
+    GC::Ptr<HTML::Task> dequeue();
 
     void remove_tasks_matching(Function<bool(HTML::Task const&)>);
     GC::RootVector<GC::Ref<Task>> take_tasks_matching(Function<bool(HTML::Task const&)>);
@@ -46,7 +41,15 @@ private:
 
     GC::Ref<HTML::EventLoop> m_event_loop;
 
+    ReadonlySpan<GC::Ref<HTML::Task>> pending_tasks() const { return m_tasks.span().slice(m_first_pending_task); }
+    void discard_dequeued_tasks();
+
+    // NOTE: Dequeuing advances m_first_pending_task instead of shifting the vector, so draining a long queue (e.g.
+    //       the microtask queue after a burst of promise reactions) is linear rather than quadratic. The dequeued
+    //       prefix is discarded once it makes up more than half of the vector, once the queue runs empty, or before any
+    //       operation that edits the middle.
     Vector<GC::Ref<HTML::Task>> m_tasks;
+    size_t m_first_pending_task { 0 };
 };
 
 }
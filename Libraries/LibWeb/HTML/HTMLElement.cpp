@@ -443,7 +443,7 @@ String HTMLElement::outer_text()
 // https://www.w3.org/TR/cssom-view-1/#dom-htmlelement-offsetparent
 GC::Ptr<DOM::Element> HTMLElement::offset_parent() const
 {
-    const_cast<DOM::Document&>(document()).update_layout();
+    const_cast<DOM::Document&>(document()).update_layout_for_node(*this);
 
     // 1. If any of the following holds true return null and terminate this algorithm:
     //    - The element does not have an associated CSS layout box.
@@ -490,7 +490,7 @@ int HTMLElement::offset_top() const
         return 0;
 
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<DOM::Document&>(document()).update_layout();
+    const_cast<DOM::Document&>(document()).update_layout_for_node(*this);
 
     if (!paintable_box())
         return 0;
@@ -532,7 +532,7 @@ int HTMLElement::offset_left() const
         return 0;
 
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<DOM::Document&>(document()).update_layout();
+    const_cast<DOM::Document&>(document()).update_layout_for_node(*this);
 
     if (!paintable_box())
         return 0;
@@ -570,7 +570,7 @@ int HTMLElement::offset_left() const
 int HTMLElement::offset_width() const
 {
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<DOM::Document&>(document()).update_layout();
+    const_cast<DOM::Document&>(document()).update_layout_for_node(*this);
 
     // 1. If the element does not have any associated box return zero and terminate this algorithm.
     auto const* box = paintable_box();
@@ -589,7 +589,7 @@ int HTMLElement::offset_width() const
 int HTMLElement::offset_height() const
 {
     // NOTE: Ensure that layout is up-to-date before looking at metrics.
-    const_cast<DOM::Document&>(document()).update_layout();
+    const_cast<DOM::Document&>(document()).update_layout_for_node(*this);
 
     // 1. If the element does not have any associated box return zero and terminate this algorithm.
     auto const* box = paintable_box();
@@ -44,6 +44,12 @@ GC::Ptr<HTMLElement> HTMLLabelElement::control() const
     // and the first such element in tree order is a labelable element, then that element is the
     // label element's labeled control.
     if (for_().has_value()) {
+        if (auto const* element_by_id_map = DOM::ElementByIdMap::for_tree_root(root())) {
+            if (auto* element = as_if<HTMLElement>(element_by_id_map->get(*for_()).ptr()); element && element->is_labelable())
+                control = element;
+            return control;
+        }
+
         root().for_each_in_inclusive_subtree_of_type<HTMLElement>([&](auto& element) {
             if (element.id() == *for_() && element.is_labelable()) {
                 control = &const_cast<HTMLElement&>(element);
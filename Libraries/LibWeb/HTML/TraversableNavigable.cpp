@@ -18,6 +18,7 @@
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Page/RenderingTrace.h>
 #include <LibWeb/Painting/BackingStore.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
@@ -1446,13 +1447,23 @@ void TraversableNavigable::paint(DevicePixelRect const& content_rect, Painting::
     paint_config.should_show_line_box_borders = paint_options.should_show_line_box_borders;
     paint_config.has_focus = paint_options.has_focus;
     paint_config.canvas_fill_rect = Gfx::IntRect { {}, content_rect.size() };
-    auto display_list = document->record_display_list(paint_config);
+    RefPtr<Painting::DisplayList> display_list;
+    {
+        RenderingTrace::PhaseTimer trace_timer { page().rendering_trace(), RenderingPhase::DisplayListRecording };
+        display_list = document->record_display_list(paint_config);
+    }
     if (!display_list)
         return;
 
-    auto painting_surface = painting_surface_for_backing_store(target);
-    m_skia_player->set_surface(painting_surface);
-    m_skia_player->execute(*display_list);
+    {
+        RenderingTrace::PhaseTimer trace_timer { page().rendering_trace(), RenderingPhase::Rasterization };
+        auto painting_surface = painting_surface_for_backing_store(target);
+        m_skia_player->set_surface(painting_surface);
+        m_skia_player->execute(*display_list);
+    }
+
+    if (auto* rendering_trace = page().rendering_trace())
+        rendering_trace->did_finish_frame(document->url().serialize());
 }
 
 }
@@ -7,6 +7,8 @@
 #include <LibJS/Runtime/VM.h>
 #include <LibWeb/Bindings/InternalsPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
+#include <LibWeb/CSS/ComputedProperties.h>
+#include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/DOM/EventTarget.h>
@@ -18,6 +20,7 @@
 #include <LibWeb/Page/Page.h>
 #include <LibWeb/Painting/PaintableBox.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
+#include <LibWeb/WebAssembly/WebAssembly.h>
 
 namespace Web::Internals {
 
@@ -249,6 +252,53 @@ void Internals::set_browser_zoom(double factor)
     internals_page().client().page_did_set_browser_zoom(factor);
 }
 
+void Internals::set_parallel_layout_enabled(bool enabled)
+{
+    internals_page().set_parallel_layout_enabled(enabled);
+}
+
+void Internals::start_wasm_profiling()
+{
+    WebAssembly::Detail::start_profiling(realm());
+}
+
+String Internals::stop_wasm_profiling()
+{
+    return WebAssembly::Detail::stop_profiling(realm());
+}
+
+String Internals::get_style_memory_statistics()
+{
+    auto& document = internals_window().associated_document();
+    document.update_style();
+
+    CSS::ComputedProperties::MemoryStatistics statistics;
+    document.for_each_shadow_including_inclusive_descendant([&](DOM::Node& node) {
+        if (auto* element = as_if<DOM::Element>(node); element && element->computed_properties())
+            element->computed_properties()->collect_memory_statistics(statistics);
+        return TraversalDecision::Continue;
+    });
+
+    auto sharing_ratio = statistics.property_group_references ? static_cast<double>(statistics.unique_property_groups) / statistics.property_group_references : 1.0;
+    return MUST(String::formatted("computed styles: {}, property groups: {} referenced, {} unique ({:.2}% of references), bytes: {} ({} without sharing)",
+        statistics.computed_properties_count,
+        statistics.property_group_references,
+        statistics.unique_property_groups,
+        sharing_ratio * 100,
+        statistics.bytes_used,
+        statistics.bytes_used_without_sharing));
+}
+
+u64 Internals::get_style_recomputation_count()
+{
+    return internals_window().associated_document().style_recomputation_count();
+}
+
+u64 Internals::get_rule_cache_build_count()
+{
+    return internals_window().associated_document().style_computer().rule_cache_build_count();
+}
+
 bool Internals::headless()
 {
     return internals_page().client().is_headless();
@@ -57,6 +57,14 @@ public:
     static void set_echo_server_port(u16 port);
 
     void set_browser_zoom(double factor);
+    void set_parallel_layout_enabled(bool enabled);
+
+    void start_wasm_profiling();
+    String stop_wasm_profiling();
+
+    String get_style_memory_statistics();
+    u64 get_style_recomputation_count();
+    u64 get_rule_cache_build_count();
 
     bool headless();
 
@@ -59,6 +59,13 @@ Optional<CSSPixelFraction> Box::natural_aspect_ratio() const
     return m_natural_aspect_ratio;
 }
 
+Box::IntrinsicSizes& Box::intrinsic_sizes() const
+{
+    if (!m_intrinsic_sizes)
+        m_intrinsic_sizes = make<IntrinsicSizes>();
+    return *m_intrinsic_sizes;
+}
+
 void Box::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
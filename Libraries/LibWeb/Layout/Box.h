@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <LibJS/Heap/Cell.h>
 #include <LibWeb/Layout/Node.h>
@@ -51,6 +52,23 @@ public:
     void clear_contained_abspos_children() { m_contained_abspos_children.clear(); }
     Vector<GC::Ref<Node>> const& contained_abspos_children() const { return m_contained_abspos_children; }
 
+    // We cache intrinsic sizes once determined, and keep them across layout passes until this box
+    // or something inside it needs layout. This avoids computing them several times while performing
+    // flex and grid layout, and again on every subsequent layout of an unchanged subtree.
+    struct IntrinsicSizes {
+        Optional<CSSPixels> min_content_width;
+        Optional<CSSPixels> max_content_width;
+
+        // The definite content height (if any) that the content widths were computed with.
+        Optional<CSSPixels> content_height_for_content_widths;
+
+        HashMap<CSSPixels, Optional<CSSPixels>> min_content_height;
+        HashMap<CSSPixels, Optional<CSSPixels>> max_content_height;
+    };
+
+    IntrinsicSizes& intrinsic_sizes() const;
+    void reset_intrinsic_sizes() const { m_intrinsic_sizes = nullptr; }
+
     virtual void visit_edges(Cell::Visitor&) override;
 
 protected:
@@ -65,6 +83,8 @@ private:
     Optional<CSSPixelFraction> m_natural_aspect_ratio;
 
     Vector<GC::Ref<Node>> m_contained_abspos_children;
+
+    mutable OwnPtr<IntrinsicSizes> m_intrinsic_sizes;
 };
 
 template<>
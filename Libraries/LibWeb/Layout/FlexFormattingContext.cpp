@@ -160,12 +160,14 @@ void FlexFormattingContext::run(AvailableSpace const& available_space)
         // This is a normal layout (not intrinsic sizing).
         // AD-HOC: Finally, layout the inside of all flex items.
         copy_dimensions_from_flex_items_to_boxes();
-        for (auto& item : m_flex_items) {
-            if (auto independent_formatting_context = layout_inside(item.box, LayoutMode::Normal, item.used_values.available_inner_space_or_constraints_from(m_available_space_for_items->space)))
-                independent_formatting_context->parent_context_did_dimension_child_root_box();
+        Vector<ChildToLayOutInside> items_to_lay_out;
+        items_to_lay_out.ensure_capacity(m_flex_items.size());
+        for (auto& item : m_flex_items)
+            items_to_lay_out.unchecked_append({ item.box, item.used_values.available_inner_space_or_constraints_from(m_available_space_for_items->space) });
+        layout_insides_of_children(items_to_lay_out);
 
+        for (auto& item : m_flex_items)
             compute_inset(item.box, content_box_rect(m_flex_container_state).size());
-        }
     }
 }
 
@@ -4,18 +4,22 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
+#include <AK/GenericShorthands.h>
 #include <LibWeb/Dump.h>
 #include <LibWeb/Layout/BlockFormattingContext.h>
 #include <LibWeb/Layout/Box.h>
 #include <LibWeb/Layout/FlexFormattingContext.h>
 #include <LibWeb/Layout/FormattingContext.h>
 #include <LibWeb/Layout/GridFormattingContext.h>
+#include <LibWeb/Layout/LayoutThreadPool.h>
 #include <LibWeb/Layout/ReplacedBox.h>
 #include <LibWeb/Layout/SVGFormattingContext.h>
 #include <LibWeb/Layout/SVGSVGBox.h>
 #include <LibWeb/Layout/TableFormattingContext.h>
 #include <LibWeb/Layout/TextNode.h>
 #include <LibWeb/Layout/Viewport.h>
+#include <LibWeb/Page/Page.h>
 
 namespace Web::Layout {
 
@@ -253,6 +257,98 @@ OwnPtr<FormattingContext> FormattingContext::layout_inside(Box const& child_box,
     return independent_formatting_context;
 }
 
+// Layout threads may only touch the used values of the subtree they were handed, and must not allocate GC cells.
+static bool can_be_laid_out_off_the_main_thread(Box const& child_box)
+{
+    if (!child_box.can_have_children())
+        return false;
+
+    auto type = FormattingContext::formatting_context_type_created_by_box(child_box);
+    if (!type.has_value() || !first_is_one_of(*type, FormattingContext::Type::Block, FormattingContext::Type::Flex, FormattingContext::Type::Grid, FormattingContext::Type::Table))
+        return false;
+
+    bool can_be_laid_out = true;
+    child_box.for_each_in_inclusive_subtree([&](Node const& node) {
+        // NOTE: Replaced boxes, SVG and list item markers depend on resources that may still be loading, and fixed
+        //       position boxes are laid out against the viewport, which is outside of the subtree.
+        if (node.is_replaced_box() || node.is_svg_box() || node.is_list_item_marker_box() || node.is_fixed_position()) {
+            can_be_laid_out = false;
+            return TraversalDecision::Break;
+        }
+        return TraversalDecision::Continue;
+    });
+    return can_be_laid_out;
+}
+
+// Fills in the caches that text layout fills lazily, so that layout threads only ever read them.
+static void prepare_for_layout_off_the_main_thread(Box const& child_box)
+{
+    child_box.for_each_in_inclusive_subtree([&](Node const& node) {
+        if (auto const* node_with_style = as_if<NodeWithStyle>(node)) {
+            node_with_style->computed_values().font_list().for_each_font_entry([](auto const& entry) {
+                (void)entry.font->harfbuzz_font();
+            });
+            (void)node_with_style->first_available_font().harfbuzz_font();
+        }
+
+        if (auto const* text_node = as_if<TextNode>(node)) {
+            auto const& font_list = text_node->computed_values().font_list();
+            for (auto code_point : text_node->text_for_rendering().code_points())
+                (void)font_list.font_for_code_point(code_point).harfbuzz_font();
+            (void)text_node->grapheme_segmenter();
+        }
+        return TraversalDecision::Continue;
+    });
+}
+
+void FormattingContext::layout_insides_of_children(Vector<ChildToLayOutInside> const& children)
+{
+    auto should_lay_out_in_parallel = [&] {
+        if (m_layout_mode != LayoutMode::Normal || children.size() < 2)
+            return false;
+        if (!context_box().document().page().is_parallel_layout_enabled())
+            return false;
+        if (LayoutThreadPool::the().thread_count() == 0)
+            return false;
+        // NOTE: Flex and grid items nested inside a subtree that is already being laid out in parallel are laid out
+        //       serially by the thread that handles that subtree.
+        if (LayoutThreadPool::is_running_task_on_current_thread())
+            return false;
+        return all_of(children, [](auto const& child) { return can_be_laid_out_off_the_main_thread(child.box); });
+    }();
+
+    if (!should_lay_out_in_parallel) {
+        for (auto const& child : children) {
+            if (auto independent_formatting_context = layout_inside(child.box, LayoutMode::Normal, child.available_space))
+                independent_formatting_context->parent_context_did_dimension_child_root_box();
+        }
+        return;
+    }
+
+    for (auto const& child : children)
+        prepare_for_layout_off_the_main_thread(child.box);
+
+    // Each child is laid out into a nested state of its own. Nested states only read from their ancestors,
+    // and we don't touch m_state until all of them are done.
+    Vector<NonnullOwnPtr<LayoutState>> nested_states;
+    Vector<Function<void()>> tasks;
+    nested_states.ensure_capacity(children.size());
+    tasks.ensure_capacity(children.size());
+    for (auto const& child : children) {
+        nested_states.unchecked_append(make<LayoutState>(&m_state));
+        tasks.unchecked_append([this, &nested_state = *nested_states.last(), &child] {
+            auto independent_formatting_context = create_independent_formatting_context_if_needed(nested_state, LayoutMode::Normal, child.box);
+            independent_formatting_context->run(child.available_space);
+            independent_formatting_context->parent_context_did_dimension_child_root_box();
+        });
+    }
+
+    LayoutThreadPool::the().run(tasks.span());
+
+    for (auto& nested_state : nested_states)
+        nested_state->merge_into_parent(m_state);
+}
+
 CSSPixels FormattingContext::greatest_child_width(Box const& box) const
 {
     CSSPixels max_width = 0;
@@ -1437,16 +1533,30 @@ CSSPixels FormattingContext::calculate_fit_content_height(Layout::Box const& box
     return calculate_max_content_height(box, available_space.width.to_px_or_zero());
 }
 
+Optional<CSSPixels> FormattingContext::cached_intrinsic_content_width(Layout::Box const& box, Optional<CSSPixels> Box::IntrinsicSizes::*width) const
+{
+    // NOTE: Content widths are computed with the box's definite height (if any) as the available height,
+    //       so they are only reusable while that height stays the same.
+    Optional<CSSPixels> content_height;
+    if (auto const& box_state = m_state.get(box); box_state.has_definite_height())
+        content_height = box_state.content_height();
+
+    auto& cache = box.intrinsic_sizes();
+    if (cache.content_height_for_content_widths != content_height) {
+        cache.min_content_width = {};
+        cache.max_content_width = {};
+        cache.content_height_for_content_widths = content_height;
+    }
+    return cache.*width;
+}
+
 CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box) const
 {
     if (box.has_natural_width())
         return *box.natural_width();
 
-    auto& root_state = m_state.m_root;
-
-    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-    if (cache.min_content_width.has_value())
-        return *cache.min_content_width;
+    if (auto cached_width = cached_intrinsic_content_width(box, &Box::IntrinsicSizes::min_content_width); cached_width.has_value())
+        return *cached_width;
 
     LayoutState throwaway_state(&m_state);
 
@@ -1466,8 +1576,9 @@ CSSPixels FormattingContext::calculate_min_content_width(Layout::Box const& box)
 
     context->run(AvailableSpace(available_width, available_height));
 
-    cache.min_content_width = clamp_to_max_dimension_value(context->automatic_content_width());
-    return *cache.min_content_width;
+    auto min_content_width = clamp_to_max_dimension_value(context->automatic_content_width());
+    box.intrinsic_sizes().min_content_width = min_content_width;
+    return min_content_width;
 }
 
 CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box) const
@@ -1475,11 +1586,8 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
     if (box.has_natural_width())
         return *box.natural_width();
 
-    auto& root_state = m_state.m_root;
-
-    auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-    if (cache.max_content_width.has_value())
-        return *cache.max_content_width;
+    if (auto cached_width = cached_intrinsic_content_width(box, &Box::IntrinsicSizes::max_content_width); cached_width.has_value())
+        return *cached_width;
 
     LayoutState throwaway_state(&m_state);
 
@@ -1499,8 +1607,9 @@ CSSPixels FormattingContext::calculate_max_content_width(Layout::Box const& box)
 
     context->run(AvailableSpace(available_width, available_height));
 
-    cache.max_content_width = clamp_to_max_dimension_value(context->automatic_content_width());
-    return *cache.max_content_width;
+    auto max_content_width = clamp_to_max_dimension_value(context->automatic_content_width());
+    box.intrinsic_sizes().max_content_width = max_content_width;
+    return max_content_width;
 }
 
 // https://www.w3.org/TR/css-sizing-3/#min-content-block-size
@@ -1514,9 +1623,7 @@ CSSPixels FormattingContext::calculate_min_content_height(Layout::Box const& box
         return *box.natural_height();
 
     auto get_cache_slot = [&]() -> Optional<CSSPixels>* {
-        auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-        return &cache.min_content_height.ensure(width);
+        return &box.intrinsic_sizes().min_content_height.ensure(width);
     };
 
     if (auto* cache_slot = get_cache_slot(); cache_slot && cache_slot->has_value())
@@ -1552,9 +1659,7 @@ CSSPixels FormattingContext::calculate_max_content_height(Layout::Box const& box
         return *box.natural_height();
 
     auto get_cache_slot = [&]() -> Optional<CSSPixels>* {
-        auto& root_state = m_state.m_root;
-        auto& cache = *root_state.intrinsic_sizes.ensure(&box, [] { return adopt_own(*new LayoutState::IntrinsicSizes); });
-        return &cache.max_content_height.ensure(width);
+        return &box.intrinsic_sizes().max_content_height.ensure(width);
     };
 
     if (auto* cache_slot = get_cache_slot(); cache_slot && cache_slot->has_value())
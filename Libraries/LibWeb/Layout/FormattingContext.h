@@ -110,6 +110,18 @@ protected:
 
     OwnPtr<FormattingContext> layout_inside(Box const&, LayoutMode, AvailableSpace const&);
 
+    struct ChildToLayOutInside {
+        GC::Ref<Box const> box;
+        AvailableSpace available_space;
+    };
+
+    // Lays out the insides of children whose own size has already been determined, like layout_inside() does.
+    // If parallel layout is enabled for the page, children that establish independent formatting contexts may
+    // be laid out on the layout thread pool.
+    void layout_insides_of_children(Vector<ChildToLayOutInside> const&);
+
+    [[nodiscard]] Optional<CSSPixels> cached_intrinsic_content_width(Box const&, Optional<CSSPixels> Box::IntrinsicSizes::*) const;
+
     struct SpaceUsedByFloats {
         CSSPixels left { 0 };
         CSSPixels right { 0 };
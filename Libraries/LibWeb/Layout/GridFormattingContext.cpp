@@ -2051,6 +2051,8 @@ void GridFormattingContext::run(AvailableSpace const& available_space)
         return;
     }
 
+    Vector<ChildToLayOutInside> items_to_lay_out;
+    items_to_lay_out.ensure_capacity(m_grid_items.size());
     for (auto& grid_item : m_grid_items) {
         CSSPixelPoint margin_offset = { grid_item.used_values.margin_box_left(), grid_item.used_values.margin_box_top() };
         auto const grid_area_rect = get_grid_area_rect(grid_item);
@@ -2058,9 +2060,9 @@ void GridFormattingContext::run(AvailableSpace const& available_space)
         compute_inset(grid_item.box, grid_area_rect.size());
 
         auto available_space_for_children = AvailableSpace(AvailableSize::make_definite(grid_item.used_values.content_width()), AvailableSize::make_definite(grid_item.used_values.content_height()));
-        if (auto independent_formatting_context = layout_inside(grid_item.box, LayoutMode::Normal, available_space_for_children))
-            independent_formatting_context->parent_context_did_dimension_child_root_box();
+        items_to_lay_out.unchecked_append({ grid_item.box, available_space_for_children });
     }
+    layout_insides_of_children(items_to_lay_out);
 
     Vector<Variant<CSS::ExplicitGridTrack, CSS::GridLineNames>> grid_track_columns;
     grid_track_columns.ensure_capacity(m_grid_columns.size());
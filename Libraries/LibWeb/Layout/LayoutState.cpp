@@ -29,46 +29,68 @@ LayoutState::~LayoutState()
 {
 }
 
+LayoutState::UsedValues* LayoutState::find_own_used_values(NodeWithStyle const& node) const
+{
+    auto layout_index = node.layout_index();
+    UsedValues* used_values = nullptr;
+    if (!m_parent) {
+        if (layout_index < m_used_values_by_layout_index.size())
+            used_values = m_used_values_by_layout_index[layout_index];
+    } else {
+        used_values = m_used_values_by_layout_index_in_nested_state.get(layout_index).value_or(nullptr);
+    }
+    VERIFY(!used_values || &used_values->node() == &node);
+    return used_values;
+}
+
+LayoutState::UsedValues& LayoutState::store_used_values(NodeWithStyle const& node, UsedValues&& used_values)
+{
+    m_used_values.append(move(used_values));
+    auto& stored_used_values = m_used_values.at(m_used_values.size() - 1);
+
+    auto layout_index = node.layout_index();
+    if (!m_parent) {
+        if (layout_index >= m_used_values_by_layout_index.size())
+            m_used_values_by_layout_index.resize(layout_index + 1);
+        m_used_values_by_layout_index[layout_index] = &stored_used_values;
+    } else {
+        m_used_values_by_layout_index_in_nested_state.set(layout_index, &stored_used_values);
+    }
+    return stored_used_values;
+}
+
 LayoutState::UsedValues& LayoutState::get_mutable(NodeWithStyle const& node)
 {
-    if (auto* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
+    if (auto* used_values = find_own_used_values(node))
         return *used_values;
 
     for (auto const* ancestor = m_parent; ancestor; ancestor = ancestor->m_parent) {
-        if (auto* ancestor_used_values = ancestor->used_values_per_layout_node.get(node).value_or(nullptr)) {
-            auto cow_used_values = adopt_own(*new UsedValues(*ancestor_used_values));
-            auto* cow_used_values_ptr = cow_used_values.ptr();
-            used_values_per_layout_node.set(node, move(cow_used_values));
-            return *cow_used_values_ptr;
-        }
+        if (auto* ancestor_used_values = ancestor->find_own_used_values(node))
+            return store_used_values(node, UsedValues(*ancestor_used_values));
     }
 
     auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
 
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
-    used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    auto& new_used_values = store_used_values(node, {});
+    new_used_values.set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
+    return new_used_values;
 }
 
 LayoutState::UsedValues const& LayoutState::get(NodeWithStyle const& node) const
 {
-    if (auto const* used_values = used_values_per_layout_node.get(node).value_or(nullptr))
+    if (auto const* used_values = find_own_used_values(node))
         return *used_values;
 
     for (auto const* ancestor = m_parent; ancestor; ancestor = ancestor->m_parent) {
-        if (auto const* ancestor_used_values = ancestor->used_values_per_layout_node.get(node).value_or(nullptr))
+        if (auto const* ancestor_used_values = ancestor->find_own_used_values(node))
             return *ancestor_used_values;
     }
 
     auto const* containing_block_used_values = node.is_viewport() ? nullptr : &get(*node.containing_block());
 
-    auto new_used_values = adopt_own(*new UsedValues);
-    auto* new_used_values_ptr = new_used_values.ptr();
-    new_used_values->set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
-    const_cast<LayoutState*>(this)->used_values_per_layout_node.set(node, move(new_used_values));
-    return *new_used_values_ptr;
+    auto& new_used_values = const_cast<LayoutState*>(this)->store_used_values(node, {});
+    new_used_values.set_node(const_cast<NodeWithStyle&>(node), containing_block_used_values);
+    return new_used_values;
 }
 
 // https://www.w3.org/TR/css-overflow-3/#scrollable-overflow
@@ -156,8 +178,7 @@ void LayoutState::resolve_relative_positions()
 {
     // This function resolves relative position offsets of fragments that belong to inline paintables.
     // It runs *after* the paint tree has been constructed, so it modifies paintable node & fragment offsets directly.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         for (auto& paintable : node.paintables()) {
@@ -204,6 +225,26 @@ static void build_paint_tree(Node& node, Painting::Paintable* parent_paintable =
     }
 }
 
+void LayoutState::merge_into_parent(LayoutState& parent)
+{
+    VERIFY(m_parent == &parent);
+
+    Vector<UsedValues&> merged_used_values;
+    merged_used_values.ensure_capacity(m_used_values.size());
+    for (auto& used_values : m_used_values) {
+        auto const& node = used_values.node();
+        auto& parent_used_values = parent.get_mutable(node);
+        parent_used_values = move(used_values);
+        merged_used_values.unchecked_append(parent_used_values);
+    }
+
+    // NOTE: The containing block pointers we just moved over may point into this state, which is about to go away.
+    for (auto& used_values : merged_used_values) {
+        auto const& node = used_values.node();
+        used_values.m_containing_block_used_values = node.is_viewport() ? nullptr : &parent.get(*node.containing_block());
+    }
+}
+
 void LayoutState::commit(Box& root)
 {
     // Only the top-level LayoutState should ever be committed.
@@ -251,8 +292,7 @@ void LayoutState::commit(Box& root)
         return false;
     };
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         if (is<NodeWithStyleAndBoxModelMetrics>(node)) {
@@ -324,8 +364,7 @@ void LayoutState::commit(Box& root)
     // Resolve relative positions for regular boxes (not line box fragments):
     // NOTE: This needs to occur before fragments are transferred into the corresponding inline paintables, because
     //       after this transfer, the containing_line_box_fragment will no longer be valid.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         auto& node = const_cast<NodeWithStyle&>(used_values.node());
 
         if (!node.is_box())
@@ -422,8 +461,7 @@ void LayoutState::commit(Box& root)
     }
 
     // Measure overflow in scroll containers.
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         if (!used_values.node().is_box())
             continue;
         auto const& box = static_cast<Layout::Box const&>(used_values.node());
@@ -437,8 +475,7 @@ void LayoutState::commit(Box& root)
             paintable_box.set_scroll_offset(paintable_box.scroll_offset());
     }
 
-    for (auto& it : used_values_per_layout_node) {
-        auto& used_values = *it.value;
+    for (auto& used_values : m_used_values) {
         if (!used_values.node().is_box())
             continue;
         auto const& box = static_cast<Layout::Box const&>(used_values.node());
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/SegmentedVector.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
 #include <LibWeb/Layout/Box.h>
@@ -176,6 +177,8 @@ struct LayoutState {
         }
 
     private:
+        friend struct LayoutState;
+
         AvailableSize available_width_inside() const;
         AvailableSize available_height_inside() const;
 
@@ -212,31 +215,32 @@ struct LayoutState {
     // Commits the used values produced by layout and builds a paintable tree.
     void commit(Box& root);
 
+    // Moves the used values produced in this nested state into its parent, which must be `parent`.
+    // This is how layout done in a nested state on a layout thread is brought back into the main state.
+    void merge_into_parent(LayoutState& parent);
+
     // NOTE: get_mutable() will CoW the UsedValues if it's inherited from an ancestor state;
     UsedValues& get_mutable(NodeWithStyle const&);
 
     // NOTE: get() will not CoW the UsedValues.
     UsedValues const& get(NodeWithStyle const&) const;
 
-    HashMap<GC::Ref<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
-
-    // We cache intrinsic sizes once determined, as they will not change over the course of a full layout.
-    // This avoids computing them several times while performing flex layout.
-    struct IntrinsicSizes {
-        Optional<CSSPixels> min_content_width;
-        Optional<CSSPixels> max_content_width;
-
-        HashMap<CSSPixels, Optional<CSSPixels>> min_content_height;
-        HashMap<CSSPixels, Optional<CSSPixels>> max_content_height;
-    };
-
-    HashMap<GC::Ptr<NodeWithStyle const>, NonnullOwnPtr<IntrinsicSizes>> mutable intrinsic_sizes;
-
     LayoutState const* m_parent { nullptr };
     LayoutState const& m_root;
 
 private:
     void resolve_relative_positions();
+
+    UsedValues* find_own_used_values(NodeWithStyle const&) const;
+    UsedValues& store_used_values(NodeWithStyle const&, UsedValues&&);
+
+    // Used values are allocated in segments, so references to them stay valid as more are added.
+    SegmentedVector<UsedValues, 16> m_used_values;
+
+    // The root state holds used values for most of the layout tree, and looks them up by the nodes' dense layout index.
+    // Nested states for intrinsic sizing only hold a few, so they map layout indices to used values instead.
+    Vector<UsedValues*> m_used_values_by_layout_index;
+    HashMap<u32, UsedValues*> m_used_values_by_layout_index_in_nested_state;
 };
 
 inline CSSPixels clamp_to_max_dimension_value(CSSPixels value)
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/NeverDestroyed.h>
+#include <LibCore/System.h>
+#include <LibGC/Heap.h>
+#include <LibWeb/Layout/LayoutThreadPool.h>
+
+namespace Web::Layout {
+
+// NOTE: Layout subtrees are small units of work, so a handful of threads is plenty, and keeps the pool from
+//       competing with the rest of the engine for every core on big machines.
+static constexpr size_t max_layout_thread_count = 8;
+
+static thread_local bool s_is_running_task = false;
+
+LayoutThreadPool& LayoutThreadPool::the()
+{
+    static NeverDestroyed<LayoutThreadPool> pool;
+    return *pool;
+}
+
+LayoutThreadPool::LayoutThreadPool()
+{
+    // The thread that calls run() works on tasks as well, so it counts towards the hardware concurrency.
+    auto thread_count = min<size_t>(Core::System::hardware_concurrency(), max_layout_thread_count + 1);
+    for (size_t i = 1; i < thread_count; ++i) {
+        auto thread = Threading::Thread::construct([this] {
+            GC::Heap::set_allocation_is_forbidden_on_current_thread(true);
+            worker_loop();
+            return 0;
+        },
+            "Layout"sv);
+        thread->start();
+        thread->detach();
+        m_threads.append(move(thread));
+    }
+}
+
+bool LayoutThreadPool::run_next_task_if_any(Threading::MutexLocker& locker)
+{
+    if (m_next_task_index >= m_tasks.size())
+        return false;
+
+    auto& task = m_tasks[m_next_task_index++];
+
+    locker.unlock();
+    s_is_running_task = true;
+    task();
+    s_is_running_task = false;
+    locker.lock();
+
+    if (--m_unfinished_task_count == 0)
+        m_tasks_finished.broadcast();
+    return true;
+}
+
+bool LayoutThreadPool::is_running_task_on_current_thread()
+{
+    return s_is_running_task;
+}
+
+void LayoutThreadPool::worker_loop()
+{
+    Threading::MutexLocker locker { m_mutex };
+    while (true) {
+        if (!run_next_task_if_any(locker))
+            m_tasks_available.wait();
+    }
+}
+
+void LayoutThreadPool::run(Span<Function<void()>> tasks)
+{
+    if (tasks.is_empty())
+        return;
+
+    // NOTE: The pool only runs one batch of tasks at a time, and the tasks of the current batch may be waiting on the
+    //       thread that would have to run a nested batch. Nested batches are rare and small, so run them serially.
+    if (s_is_running_task) {
+        for (auto& task : tasks)
+            task();
+        return;
+    }
+
+    Threading::MutexLocker locker { m_mutex };
+    VERIFY(m_tasks.is_empty());
+
+    m_tasks = tasks;
+    m_next_task_index = 0;
+    m_unfinished_task_count = tasks.size();
+    m_tasks_available.broadcast();
+
+    // NOTE: The calling thread is the one that owns the GC heap, so it may do whatever the tasks are allowed to do.
+    while (run_next_task_if_any(locker))
+        ;
+
+    m_tasks_finished.wait_while([&] { return m_unfinished_task_count > 0; });
+    m_tasks = {};
+}
+
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Span.h>
+#include <AK/Vector.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
+
+namespace Web::Layout {
+
+// A fixed set of worker threads that lay out independent formatting contexts in parallel.
+// Workers are forbidden from allocating GC cells, and may only touch the part of the layout tree they were handed.
+class LayoutThreadPool {
+    AK_MAKE_NONCOPYABLE(LayoutThreadPool);
+    AK_MAKE_NONMOVABLE(LayoutThreadPool);
+
+public:
+    static LayoutThreadPool& the();
+
+    size_t thread_count() const { return m_threads.size(); }
+
+    // Runs all of the tasks and returns once every one of them has finished. The calling thread runs tasks too.
+    // If called from within a task, the tasks are run one after another on the calling thread instead.
+    void run(Span<Function<void()>> tasks);
+
+    // Whether the current thread is in the middle of running one of the pool's tasks. This is true for the thread
+    // that called run() too, while it helps out with the tasks.
+    static bool is_running_task_on_current_thread();
+
+private:
+    LayoutThreadPool();
+
+    void worker_loop();
+    bool run_next_task_if_any(Threading::MutexLocker&);
+
+    Vector<NonnullRefPtr<Threading::Thread>> m_threads;
+
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_tasks_available { m_mutex };
+    Threading::ConditionVariable m_tasks_finished { m_mutex };
+
+    Span<Function<void()>> m_tasks;
+    size_t m_next_task_index { 0 };
+    size_t m_unfinished_task_count { 0 };
+};
+
+}
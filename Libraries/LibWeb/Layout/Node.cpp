@@ -1115,9 +1115,16 @@ void Node::clear_paintables()
     m_paintable.clear();
 }
 
-GC::Ptr<Painting::Paintable> Node::create_paintable() const
+void Node::invalidate_layout(DOM::SetNeedsLayoutReason reason)
 {
-    return nullptr;
+    // NOTE: The intrinsic sizes of a box depend on everything inside it, so they have to be recomputed for
+    //       this node and all of its ancestors.
+    for (auto* node = this; node; node = node->parent()) {
+        if (auto* box = as_if<Box>(*node))
+            box->reset_intrinsic_sizes();
+    }
+
+    document().did_mark_layout_node_as_needing_layout({}, reason);
 }
 
 bool Node::is_anonymous() const
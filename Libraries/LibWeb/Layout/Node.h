@@ -161,6 +161,15 @@ public:
     void removed_from(Node&) { }
     void children_changed() { }
 
+    // Drops the cached intrinsic sizes of this node and its ancestors, and schedules a layout of the document.
+    // NOTE: Layout itself always runs from the root.
+    void invalidate_layout(DOM::SetNeedsLayoutReason);
+
+    // A dense index of this node within the layout tree, assigned in tree order before each layout.
+    // LayoutState uses it to look up used values without hashing.
+    [[nodiscard]] u32 layout_index() const { return m_layout_index; }
+    void set_layout_index(Badge<DOM::Document>, u32 index) { m_layout_index = index; }
+
     bool children_are_inline() const { return m_children_are_inline; }
     void set_children_are_inline(bool value) { m_children_are_inline = value; }
 
@@ -219,6 +228,8 @@ private:
     GeneratedFor m_generated_for { GeneratedFor::NotGenerated };
 
     u32 m_initial_quote_nesting_level { 0 };
+
+    u32 m_layout_index { 0 };
 };
 
 class NodeWithStyle : public Node {
@@ -118,14 +118,26 @@ void TableFormattingContext::compute_cell_measures()
         CSSPixels border_left = use_collapsing_borders_model ? round(cell_state.border_left / 2) : computed_values.border_left().width;
         CSSPixels border_right = use_collapsing_borders_model ? round(cell_state.border_right / 2) : computed_values.border_right().width;
 
+        auto min_height = computed_values.min_height().to_px(cell.box, containing_block.content_height());
+        auto cell_intrinsic_height_offsets = padding_top + padding_bottom + border_top + border_bottom;
+
+        // OPTIMIZATION: In fixed mode, only the cells of the first row contribute to the column widths. The height of a cell
+        //               spanning a single row is established when it gets laid out with its used width in compute_table_height(),
+        //               so there is no need to measure the intrinsic sizes of any other single-row cell. This keeps the cost of
+        //               fixed layout proportional to the size of the first row rather than to the size of the whole table.
+        if (use_fixed_mode_layout() && cell.row_index != 0 && cell.row_span == 1) {
+            auto height = computed_values.height().is_length() ? computed_values.height().to_px(cell.box, containing_block.content_height()) : 0;
+            cell.outer_min_height = min_height + cell_intrinsic_height_offsets;
+            cell.outer_max_height = max(min_height, height) + cell_intrinsic_height_offsets;
+            continue;
+        }
+
         auto min_content_width = calculate_min_content_width(cell.box);
         auto max_content_width = calculate_max_content_width(cell.box);
         auto min_content_height = calculate_min_content_height(cell.box, max_content_width);
         auto max_content_height = calculate_max_content_height(cell.box, min_content_width);
 
         // The outer min-content height of a table-cell is max(min-height, min-content height) adjusted by the cell intrinsic offsets.
-        auto min_height = computed_values.min_height().to_px(cell.box, containing_block.content_height());
-        auto cell_intrinsic_height_offsets = padding_top + padding_bottom + border_top + border_bottom;
         cell.outer_min_height = max(min_height, min_content_height) + cell_intrinsic_height_offsets;
         // The outer min-content width of a table-cell is max(min-width, min-content width) adjusted by the cell intrinsic offsets.
         auto min_width = computed_values.min_width().to_px(cell.box, containing_block.content_width());
@@ -479,11 +479,75 @@ Optional<TextNode::Chunk> TextNode::ChunkIterator::peek(size_t count)
     return m_peek_queue[count];
 }
 
+Gfx::Font const& TextNode::ChunkIterator::font_for_ascii_byte(u8 byte)
+{
+    auto& font = m_fonts_for_ascii_bytes[byte];
+    if (!font)
+        font = &m_font_cascade_list.font_for_code_point(byte);
+    return *font;
+}
+
+static Gfx::GlyphRun::TextType text_type_for_ascii_byte(u8 byte)
+{
+    static auto const text_types = [] {
+        Array<Gfx::GlyphRun::TextType, 128> text_types;
+        for (u8 i = 0; i < 128; ++i)
+            text_types[i] = text_type_for_code_point(i);
+        return text_types;
+    }();
+    return text_types[byte];
+}
+
+// OPTIMIZATION: Most text is plain ASCII, where every byte is a grapheme of its own, and the font and text type only
+//               depend on the byte. This finds the same chunk that next_without_peek() would, without going through
+//               the grapheme segmenter or looking up fonts and bidi classes for every code point. It only handles
+//               wrapping text, and gives up whenever the general path is needed.
+Optional<TextNode::Chunk> TextNode::ChunkIterator::try_next_ascii_chunk()
+{
+    auto const* bytes = m_utf8_view.bytes();
+    auto byte_length = m_utf8_view.byte_length();
+    auto start = m_current_index;
+
+    // NOTE: Tabs and preserved newlines need special treatment, and "\r\n" is a single grapheme.
+    auto first_byte = bytes[start];
+    if (!is_ascii(first_byte) || first_byte == '\t' || first_byte == '\r' || (m_respect_linebreaks && first_byte == '\n'))
+        return {};
+
+    auto const& font = font_for_ascii_byte(first_byte);
+    auto text_type = text_type_for_ascii_byte(first_byte);
+
+    // Whitespace is committed one grapheme at a time.
+    if (is_ascii_space(first_byte)) {
+        m_current_index = start + 1;
+        return try_commit_chunk(start, m_current_index, false, false, font, text_type);
+    }
+
+    auto end = start + 1;
+    for (; end < byte_length; ++end) {
+        auto byte = bytes[end];
+
+        // NOTE: A non-ASCII code point (e.g. a combining mark) could still belong to this chunk.
+        if (!is_ascii(byte))
+            return {};
+
+        if (is_ascii_space(byte) || text_type_for_ascii_byte(byte) != text_type || &font_for_ascii_byte(byte) != &font)
+            break;
+    }
+
+    m_current_index = end;
+    return try_commit_chunk(start, end, false, false, font, text_type);
+}
+
 Optional<TextNode::Chunk> TextNode::ChunkIterator::next_without_peek()
 {
     if (m_current_index >= m_utf8_view.byte_length())
         return {};
 
+    if (m_wrap_lines) {
+        if (auto chunk = try_next_ascii_chunk(); chunk.has_value())
+            return chunk;
+    }
+
     auto current_code_point = [this]() {
         return *m_utf8_view.iterator_at_byte_offset_without_validation(m_current_index);
     };
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/Utf8View.h>
 #include <LibUnicode/Segmenter.h>
 #include <LibWeb/DOM/Text.h>
@@ -47,8 +48,11 @@ public:
 
     private:
         Optional<Chunk> next_without_peek();
+        Optional<Chunk> try_next_ascii_chunk();
         Optional<Chunk> try_commit_chunk(size_t start, size_t end, bool has_breaking_newline, bool has_breaking_tab, Gfx::Font const&, Gfx::GlyphRun::TextType) const;
 
+        Gfx::Font const& font_for_ascii_byte(u8);
+
         bool const m_wrap_lines;
         bool const m_respect_linebreaks;
         Utf8View m_utf8_view;
@@ -58,6 +62,8 @@ public:
         size_t m_current_index { 0 };
 
         Vector<Chunk> m_peek_queue;
+
+        Array<Gfx::Font const*, 128> m_fonts_for_ascii_bytes {};
     };
 
     void invalidate_text_for_rendering();
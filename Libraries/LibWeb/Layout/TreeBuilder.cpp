@@ -450,6 +450,72 @@ i32 TreeBuilder::calculate_list_item_index(DOM::Node& dom_node)
     return 1;
 }
 
+// When an ancestor's layout subtree is rebuilt, unchanged elements below it can keep their existing layout subtree, as
+// long as nothing in it depends on what comes before it in the tree, and moving it doesn't require restructuring.
+bool TreeBuilder::can_reuse_layout_subtree(DOM::Node const& dom_node, Context const& context) const
+{
+    if (!is<DOM::Element>(dom_node))
+        return false;
+    auto const& element = static_cast<DOM::Element const&>(dom_node);
+
+    if (element.needs_layout_tree_update() || element.child_needs_layout_tree_update() || element.document().needs_full_layout_tree_update())
+        return false;
+    if (context.has_svg_root || context.layout_svg_mask_or_clip_path || element.is_svg_element())
+        return false;
+
+    auto const* layout_node = element.layout_node();
+    if (!layout_node || !layout_node->parent() || !is<Box>(*layout_node) || layout_node->dom_node() != &element)
+        return false;
+
+    // NOTE: Only block-level boxes can be moved into a new parent without restructuring anything around them.
+    //       Tables are excluded as well, since they have already been wrapped in a table wrapper box.
+    auto display = layout_node->display();
+    if (display != element.computed_properties()->display()
+        || !display.is_block_outside()
+        || display.is_list_item()
+        || display.is_table_inside())
+        return false;
+
+    for (auto const& ancestor : m_ancestor_stack.in_reverse()) {
+        auto ancestor_display = ancestor->display();
+        if (ancestor_display.is_contents())
+            continue;
+        if (ancestor_display.is_inline_outside() && ancestor_display.is_flow_inside())
+            return false;
+        break;
+    }
+
+    // NOTE: List item markers, generated content and counters depend on the elements that come before them. The
+    //       counters themselves are resolved again when the subtree is reused.
+    bool can_reuse = true;
+    layout_node->for_each_in_inclusive_subtree([&](Node const& node) {
+        auto const* dom_element = as_if<DOM::Element>(node.dom_node());
+        if (node.is_generated() || node.is_list_item_box() || node.is_list_item_marker_box()
+            || (dom_element && dom_element->has_non_empty_counters_set())) {
+            can_reuse = false;
+            return TraversalDecision::Break;
+        }
+        return TraversalDecision::Continue;
+    });
+    return can_reuse;
+}
+
+// Elements before a reused subtree may have started, changed or stopped counters since it was built. Nothing inside the
+// subtree uses counter values (see can_reuse_layout_subtree()), but the elements after it inherit their counters from
+// it, so they have to be resolved again, like update_layout_tree() would have.
+static void resolve_counters_in_reused_subtree(DOM::Element& element)
+{
+    element.for_each_in_inclusive_subtree_of_type<DOM::Element>([](DOM::Element& descendant) {
+        auto style = descendant.computed_properties();
+        if (!style)
+            return TraversalDecision::SkipChildrenAndContinue;
+        descendant.resolve_counters(*style);
+        if (style->display().is_none())
+            return TraversalDecision::SkipChildrenAndContinue;
+        return TraversalDecision::Continue;
+    });
+}
+
 void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context& context, MustCreateSubtree must_create_subtree)
 {
     bool should_create_layout_node = must_create_subtree == MustCreateSubtree::Yes
@@ -462,6 +528,17 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
         if (element.rendered_in_top_layer() && !context.layout_top_layer)
             return;
     }
+
+    // OPTIMIZATION: If this node hasn't changed, move its existing layout subtree into the rebuilt parent instead of
+    //               building it again.
+    if (must_create_subtree == MustCreateSubtree::Yes && can_reuse_layout_subtree(dom_node, context)) {
+        auto& layout_node = *dom_node.layout_node();
+        resolve_counters_in_reused_subtree(static_cast<DOM::Element&>(dom_node));
+        layout_node.remove();
+        insert_node_into_inline_or_block_ancestor(layout_node, layout_node.display(), AppendOrPrepend::Append);
+        layout_node.invalidate_layout(DOM::SetNeedsLayoutReason::LayoutTreeUpdate);
+        return;
+    }
     if (dom_node.is_element())
         dom_node.document().style_computer().push_ancestor(static_cast<DOM::Element const&>(dom_node));
 
@@ -561,25 +638,31 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
                 insert_node_into_inline_or_block_ancestor(*layout_node, display, AppendOrPrepend::Append);
             }
         }
+        layout_node->invalidate_layout(DOM::SetNeedsLayoutReason::LayoutTreeUpdate);
     }
 
     auto shadow_root = is<DOM::Element>(dom_node) ? as<DOM::Element>(dom_node).shadow_root() : nullptr;
 
-    auto element_has_content_visibility_hidden = [&dom_node]() {
-        if (is<DOM::Element>(dom_node)) {
-            auto& element = static_cast<DOM::Element&>(dom_node);
-            return element.computed_properties()->content_visibility() == CSS::ContentVisibility::Hidden;
-        }
-        return false;
+    // NOTE: An element with content-visibility: hidden, or content-visibility: auto that isn't relevant to the user,
+    //       skips its contents. We leave them out of the layout tree entirely, so they aren't laid out or painted.
+    auto element_skips_its_contents = [&dom_node, should_create_layout_node]() {
+        if (!is<DOM::Element>(dom_node))
+            return false;
+        auto& element = static_cast<DOM::Element&>(dom_node);
+        if (!should_create_layout_node)
+            return element.contents_are_skipped_in_layout_tree();
+        auto skips_its_contents = element.skips_its_contents();
+        element.set_contents_are_skipped_in_layout_tree({}, skips_its_contents);
+        return skips_its_contents;
     }();
 
     auto prior_quote_nesting_level = m_quote_nesting_level;
 
     if (should_create_layout_node)
-        update_layout_tree_before_children(dom_node, *layout_node, context, element_has_content_visibility_hidden);
+        update_layout_tree_before_children(dom_node, *layout_node, context, element_skips_its_contents);
 
     if (should_create_layout_node || dom_node.child_needs_layout_tree_update()) {
-        if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+        if ((dom_node.has_children() || shadow_root) && layout_node->can_have_children() && !element_skips_its_contents) {
             push_parent(as<NodeWithStyle>(*layout_node));
             if (shadow_root) {
                 for (auto* node = shadow_root->first_child(); node; node = node->next_sibling()) {
@@ -607,7 +690,7 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
     }
 
     if (should_create_layout_node) {
-        update_layout_tree_after_children(dom_node, *layout_node, context, element_has_content_visibility_hidden);
+        update_layout_tree_after_children(dom_node, *layout_node, context, element_skips_its_contents);
         wrap_in_button_layout_tree_if_needed(dom_node, *layout_node);
 
         // If we completely finished inserting a block level element into an inline parent, we need to fix up the tree so
@@ -697,10 +780,10 @@ void TreeBuilder::wrap_in_button_layout_tree_if_needed(DOM::Node& dom_node, GC::
     }
 }
 
-void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context&, bool element_has_content_visibility_hidden)
+void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context&, bool element_skips_its_contents)
 {
     // Add node for the ::before pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(as<NodeWithStyle>(*layout_node));
         create_pseudo_element_if_needed(element, CSS::Selector::PseudoElement::Type::Before, AppendOrPrepend::Prepend);
@@ -708,7 +791,7 @@ void TreeBuilder::update_layout_tree_before_children(DOM::Node& dom_node, GC::Re
     }
 }
 
-void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context& context, bool element_has_content_visibility_hidden)
+void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref<Layout::Node> layout_node, TreeBuilder::Context& context, bool element_skips_its_contents)
 {
     auto& document = dom_node.document();
     auto& style_computer = document.style_computer();
@@ -725,7 +808,7 @@ void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref
     if (is<HTML::HTMLSlotElement>(dom_node)) {
         auto& slot_element = static_cast<HTML::HTMLSlotElement&>(dom_node);
 
-        if (slot_element.computed_properties()->content_visibility() == CSS::ContentVisibility::Hidden)
+        if (element_skips_its_contents)
             return;
 
         auto slottables = slot_element.assigned_nodes_internal();
@@ -756,7 +839,7 @@ void TreeBuilder::update_layout_tree_after_children(DOM::Node& dom_node, GC::Ref
     }
 
     // Add nodes for the ::after pseudo-element.
-    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_has_content_visibility_hidden) {
+    if (is<DOM::Element>(dom_node) && layout_node->can_have_children() && !element_skips_its_contents) {
         auto& element = static_cast<DOM::Element&>(dom_node);
         push_parent(as<NodeWithStyle>(*layout_node));
         create_pseudo_element_if_needed(element, CSS::Selector::PseudoElement::Type::After, AppendOrPrepend::Append);
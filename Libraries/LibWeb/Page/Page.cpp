@@ -23,6 +23,7 @@
 #include <LibWeb/HTML/TraversableNavigable.h>
 #include <LibWeb/HTML/Window.h>
 #include <LibWeb/Page/Page.h>
+#include <LibWeb/Page/RenderingTrace.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
 #include <LibWeb/Selection/Selection.h>
 
@@ -564,6 +565,14 @@ void Page::set_user_style(String source)
     }
 }
 
+void Page::set_rendering_trace_enabled(bool enabled)
+{
+    if (!enabled)
+        m_rendering_trace = nullptr;
+    else if (!m_rendering_trace)
+        m_rendering_trace = make<RenderingTrace>();
+}
+
 Vector<GC::Root<DOM::Document>> Page::documents_in_active_window() const
 {
     if (!top_level_traversable_is_initialized())
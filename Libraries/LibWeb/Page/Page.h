@@ -201,6 +201,14 @@ public:
 
     bool pdf_viewer_supported() const { return m_pdf_viewer_supported; }
 
+    // Returns null unless rendering tracing has been enabled for this page.
+    RenderingTrace* rendering_trace() { return m_rendering_trace.ptr(); }
+    void set_rendering_trace_enabled(bool);
+
+    // When enabled, layout may run independent formatting contexts on the layout thread pool.
+    bool is_parallel_layout_enabled() const { return m_parallel_layout_enabled; }
+    void set_parallel_layout_enabled(bool enabled) { m_parallel_layout_enabled = enabled; }
+
     void clear_selection();
 
     enum class WrapAround {
@@ -289,6 +297,9 @@ private:
     size_t m_find_in_page_match_index { 0 };
     Optional<FindInPageQuery> m_last_find_in_page_query;
     URL::URL m_last_find_in_page_url;
+
+    OwnPtr<RenderingTrace> m_rendering_trace;
+    bool m_parallel_layout_enabled { false };
 };
 
 struct PaintOptions {
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArraySerializer.h>
+#include <AK/JsonObjectSerializer.h>
+#include <AK/StringBuilder.h>
+#include <LibWeb/Page/RenderingTrace.h>
+
+namespace Web {
+
+StringView to_string(RenderingPhase phase)
+{
+#define __ENUMERATE_RENDERING_PHASE(phase) \
+    case RenderingPhase::phase:            \
+        return #phase##sv;
+    switch (phase) {
+        ENUMERATE_RENDERING_PHASES(__ENUMERATE_RENDERING_PHASE)
+    default:
+        VERIFY_NOT_REACHED();
+    }
+#undef __ENUMERATE_RENDERING_PHASE
+}
+
+static Optional<StringView> item_count_name(RenderingPhase phase)
+{
+    switch (phase) {
+    case RenderingPhase::Style:
+        return "restyledElements"sv;
+    case RenderingPhase::Layout:
+        return "laidOutNodes"sv;
+    default:
+        return {};
+    }
+}
+
+RenderingTrace::PhaseTimer::PhaseTimer(RenderingTrace* trace, RenderingPhase phase)
+    : m_trace(trace)
+    , m_phase(phase)
+{
+    if (m_trace)
+        m_start_time = MonotonicTime::now();
+}
+
+RenderingTrace::PhaseTimer::~PhaseTimer()
+{
+    if (m_trace)
+        m_trace->did_finish_phase(m_phase, *m_start_time, m_item_count);
+}
+
+void RenderingTrace::did_finish_phase(RenderingPhase phase, MonotonicTime start_time, Optional<size_t> item_count)
+{
+    // NOTE: Scripts that repeatedly force style and layout can run these phases any number of times per frame,
+    //       so we only keep the first runs and count the rest.
+    if (m_current_frame.phases.size() >= max_phase_count_per_frame) {
+        ++m_current_frame.dropped_phase_count;
+        return;
+    }
+    m_current_frame.phases.append({ phase, start_time, MonotonicTime::now(), item_count });
+}
+
+void RenderingTrace::did_finish_frame(String url)
+{
+    auto next_frame_id = m_current_frame.id + 1;
+    m_current_frame.url = move(url);
+    m_finished_frames.enqueue(move(m_current_frame));
+    m_current_frame = Frame { .id = next_frame_id };
+}
+
+void RenderingTrace::reset()
+{
+    auto next_frame_id = m_current_frame.id + 1;
+    m_finished_frames.clear();
+    m_current_frame = Frame { .id = next_frame_id };
+}
+
+// https://docs.google.com/document/d/1CvAClvFfyA5R-PhYUmn5OOQtYMH4h6I0nSsKchNAySU
+String RenderingTrace::to_chrome_trace_json() const
+{
+    auto microseconds = [](MonotonicTime time) {
+        return static_cast<double>(time.nanoseconds()) / 1000;
+    };
+
+    StringBuilder builder;
+    auto trace = MUST(JsonObjectSerializer<>::try_create(builder));
+    auto events = MUST(trace.add_array("traceEvents"sv));
+
+    auto add_event = [&](StringView name, char const* type, MonotonicTime start_time, Optional<MonotonicTime> end_time) {
+        auto event = MUST(events.add_object());
+        MUST(event.add("name"sv, name));
+        MUST(event.add("cat"sv, "rendering"sv));
+        MUST(event.add("ph"sv, type));
+        MUST(event.add("ts"sv, microseconds(start_time)));
+        if (end_time.has_value())
+            MUST(event.add("dur"sv, microseconds(*end_time) - microseconds(start_time)));
+        else
+            MUST(event.add("s"sv, "t"sv));
+        MUST(event.add("pid"sv, 1));
+        MUST(event.add("tid"sv, 1));
+        return event;
+    };
+
+    auto serialize_frame = [&](Frame const& frame) {
+        if (frame.phases.is_empty())
+            return;
+        auto frame_start_time = frame.phases.first().start_time;
+        auto frame_end_time = frame.phases.last().end_time;
+
+        {
+            auto event = add_event("Frame"sv, "X", frame_start_time, frame_end_time);
+            auto args = MUST(event.add_object("args"sv));
+            MUST(args.add("frame"sv, frame.id));
+            if (!frame.url.is_empty())
+                MUST(args.add("url"sv, frame.url));
+            if (frame.dropped_phase_count > 0)
+                MUST(args.add("droppedPhases"sv, frame.dropped_phase_count));
+            MUST(args.finish());
+            MUST(event.finish());
+        }
+
+        for (auto const& phase : frame.phases) {
+            auto event = add_event(to_string(phase.phase), "X", phase.start_time, phase.end_time);
+            auto args = MUST(event.add_object("args"sv));
+            MUST(args.add("frame"sv, frame.id));
+            if (auto name = item_count_name(phase.phase); name.has_value() && phase.item_count.has_value())
+                MUST(args.add(*name, *phase.item_count));
+            MUST(args.finish());
+            MUST(event.finish());
+        }
+
+        auto event = add_event("Invalidations"sv, "i", frame_start_time, {});
+        auto args = MUST(event.add_object("args"sv));
+        MUST(args.add("frame"sv, frame.id));
+
+        auto style = MUST(args.add_object("style"sv));
+#define __ENUMERATE_STYLE_INVALIDATION_REASON(reason)                                                           \
+    if (auto count = frame.style_invalidation_counts[to_underlying(DOM::StyleInvalidationReason::reason)]) \
+        MUST(style.add(#reason##sv, count));
+        ENUMERATE_STYLE_INVALIDATION_REASONS(__ENUMERATE_STYLE_INVALIDATION_REASON)
+#undef __ENUMERATE_STYLE_INVALIDATION_REASON
+        MUST(style.finish());
+
+        auto layout = MUST(args.add_object("layout"sv));
+#define __ENUMERATE_SET_NEEDS_LAYOUT_REASON(reason)                                                         \
+    if (auto count = frame.layout_invalidation_counts[to_underlying(DOM::SetNeedsLayoutReason::reason)]) \
+        MUST(layout.add(#reason##sv, count));
+        ENUMERATE_SET_NEEDS_LAYOUT_REASONS(__ENUMERATE_SET_NEEDS_LAYOUT_REASON)
+#undef __ENUMERATE_SET_NEEDS_LAYOUT_REASON
+        MUST(layout.finish());
+
+        MUST(args.finish());
+        MUST(event.finish());
+    };
+
+    for (auto const& frame : m_finished_frames)
+        serialize_frame(frame);
+    serialize_frame(m_current_frame);
+
+    MUST(events.finish());
+    MUST(trace.add("displayTimeUnit"sv, "ms"sv));
+    MUST(trace.finish());
+
+    return MUST(builder.to_string());
+}
+
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Array.h>
+#include <AK/CircularQueue.h>
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibWeb/DOM/Node.h>
+
+namespace Web {
+
+#define ENUMERATE_RENDERING_PHASES(X) \
+    X(Style)                          \
+    X(LayoutTreeBuild)                \
+    X(Layout)                         \
+    X(DisplayListRecording)           \
+    X(Rasterization)
+
+enum class RenderingPhase {
+#define __ENUMERATE_RENDERING_PHASE(phase) phase,
+    ENUMERATE_RENDERING_PHASES(__ENUMERATE_RENDERING_PHASE)
+#undef __ENUMERATE_RENDERING_PHASE
+};
+
+StringView to_string(RenderingPhase);
+
+// Records how long each phase of the rendering pipeline took, and what caused style and layout to be invalidated,
+// for the most recent frames of a page. Each frame is labeled with the URL of the document it rendered. The result can be exported in the Chrome trace event format, which can be
+// loaded into chrome://tracing or Perfetto.
+class RenderingTrace {
+    AK_MAKE_NONCOPYABLE(RenderingTrace);
+    AK_MAKE_NONMOVABLE(RenderingTrace);
+
+public:
+    RenderingTrace() = default;
+
+    static constexpr size_t max_frame_count = 256;
+    static constexpr size_t max_phase_count_per_frame = 256;
+
+    // Times a single run of a phase. Does nothing if the trace is null, so that call sites don't have to check whether
+    // tracing is enabled.
+    class PhaseTimer {
+        AK_MAKE_NONCOPYABLE(PhaseTimer);
+        AK_MAKE_NONMOVABLE(PhaseTimer);
+
+    public:
+        PhaseTimer(RenderingTrace*, RenderingPhase);
+        ~PhaseTimer();
+
+        // The number of elements restyled, or layout nodes laid out, during this run of the phase.
+        void set_item_count(size_t item_count) { m_item_count = item_count; }
+
+    private:
+        RenderingTrace* m_trace { nullptr };
+        RenderingPhase m_phase;
+        Optional<MonotonicTime> m_start_time;
+        Optional<size_t> m_item_count;
+    };
+
+    void did_invalidate_style(DOM::StyleInvalidationReason reason) { ++m_current_frame.style_invalidation_counts[to_underlying(reason)]; }
+    void did_set_needs_layout(DOM::SetNeedsLayoutReason reason) { ++m_current_frame.layout_invalidation_counts[to_underlying(reason)]; }
+
+    // Called once a frame of the given document has been rasterized. Everything recorded afterwards is attributed to
+    // the next frame.
+    void did_finish_frame(String url);
+
+    // Drops every recorded frame, so that a trace can be taken for each page load or test separately.
+    void reset();
+
+    String to_chrome_trace_json() const;
+
+private:
+    static constexpr size_t style_invalidation_reason_count = 0
+#define __ENUMERATE_STYLE_INVALIDATION_REASON(reason) +1
+        ENUMERATE_STYLE_INVALIDATION_REASONS(__ENUMERATE_STYLE_INVALIDATION_REASON)
+#undef __ENUMERATE_STYLE_INVALIDATION_REASON
+        ;
+    static constexpr size_t layout_invalidation_reason_count = 0
+#define __ENUMERATE_SET_NEEDS_LAYOUT_REASON(reason) +1
+        ENUMERATE_SET_NEEDS_LAYOUT_REASONS(__ENUMERATE_SET_NEEDS_LAYOUT_REASON)
+#undef __ENUMERATE_SET_NEEDS_LAYOUT_REASON
+        ;
+
+    struct Phase {
+        RenderingPhase phase;
+        MonotonicTime start_time;
+        MonotonicTime end_time;
+        Optional<size_t> item_count;
+    };
+
+    struct Frame {
+        u64 id { 0 };
+        String url;
+        Vector<Phase> phases;
+        size_t dropped_phase_count { 0 };
+        Array<u32, style_invalidation_reason_count> style_invalidation_counts {};
+        Array<u32, layout_invalidation_reason_count> layout_invalidation_counts {};
+    };
+
+    void did_finish_phase(RenderingPhase, MonotonicTime start_time, Optional<size_t> item_count);
+
+    Frame m_current_frame { .id = 1 };
+    CircularQueue<Frame, max_frame_count> m_finished_frames;
+};
+
+}
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <AK/ByteBuffer.h>
 #include <AK/MemoryStream.h>
 #include <AK/ScopeGuard.h>
@@ -155,6 +156,89 @@ WebIDL::ExceptionOr<GC::Ref<WebIDL::Promise>> instantiate_streaming(JS::VM& vm,
 
 namespace Detail {
 
+static bool is_numeric_value_type(Wasm::ValueType const& type)
+{
+    switch (type.kind()) {
+    case Wasm::ValueType::I32:
+    case Wasm::ValueType::F32:
+    case Wasm::ValueType::F64:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Signatures made only of i32/f32/f64 values (with at most one result) never touch BigInts, references or the
+// per-realm caches, so calls through them can skip the generic ToWebAssemblyValue/ToJSValue conversions and the
+// GC-rooted argument vectors.
+static bool is_numeric_signature(Wasm::FunctionType const& type)
+{
+    return type.results().size() <= 1
+        && all_of(type.parameters(), is_numeric_value_type)
+        && all_of(type.results(), is_numeric_value_type);
+}
+
+ALWAYS_INLINE static JS::ThrowCompletionOr<Wasm::Value> to_numeric_webassembly_value(JS::VM& vm, JS::Value value, Wasm::ValueType const& type)
+{
+    switch (type.kind()) {
+    case Wasm::ValueType::I32:
+        if (value.is_int32())
+            return Wasm::Value { value.as_i32() };
+        return Wasm::Value { TRY(value.to_i32(vm)) };
+    case Wasm::ValueType::F64:
+        if (value.is_number())
+            return Wasm::Value { value.as_double() };
+        return Wasm::Value { TRY(value.to_double(vm)) };
+    case Wasm::ValueType::F32:
+        if (value.is_number())
+            return Wasm::Value { static_cast<float>(value.as_double()) };
+        return Wasm::Value { static_cast<float>(TRY(value.to_double(vm))) };
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+ALWAYS_INLINE static JS::Value to_numeric_js_value(Wasm::Value const& wasm_value, Wasm::ValueType const& type)
+{
+    switch (type.kind()) {
+    case Wasm::ValueType::I32:
+        return JS::Value(wasm_value.to<i32>());
+    case Wasm::ValueType::F64:
+        return JS::Value(wasm_value.to<double>());
+    case Wasm::ValueType::F32:
+        return JS::Value(static_cast<double>(wasm_value.to<float>()));
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+// Number of locals (parameters included) the callee's frame will need, so the argument vector can be allocated
+// once at its final size instead of growing when Configuration::call() appends the declared locals.
+static size_t frame_size_for_function(Wasm::Store& store, Wasm::FunctionAddress address, Wasm::FunctionType const& type)
+{
+    size_t size = type.parameters().size();
+    if (auto* function = store.get(address); function && function->has<Wasm::WasmFunction>()) {
+        for (auto& local : function->get<Wasm::WasmFunction>().code().func().locals())
+            size += local.n();
+    }
+    return size;
+}
+
+static Wasm::Result call_numeric_host_function(JS::VM& vm, JS::FunctionObject& function, Wasm::FunctionType const& type, Vector<Wasm::Value>& arguments)
+{
+    // Numbers are not cells, so there is no need to root them for the duration of the call.
+    Vector<JS::Value, 8> argument_values;
+    argument_values.ensure_capacity(arguments.size());
+    for (size_t i = 0; i < arguments.size(); ++i)
+        argument_values.unchecked_append(to_numeric_js_value(arguments[i], type.parameters()[i]));
+
+    auto result = TRY(JS::call(vm, function, JS::js_undefined(), argument_values.span()));
+    if (type.results().is_empty())
+        return Wasm::Result { Vector<Wasm::Value> {} };
+
+    return Wasm::Result { Vector<Wasm::Value> { TRY(to_numeric_webassembly_value(vm, result, type.results().first())) } };
+}
+
 JS::ThrowCompletionOr<NonnullOwnPtr<Wasm::ModuleInstance>> instantiate_module(JS::VM& vm, Wasm::Module const& module, GC::Ptr<JS::Object> import_object)
 {
     Wasm::Linker linker { module };
@@ -207,7 +291,10 @@ JS::ThrowCompletionOr<NonnullOwnPtr<Wasm::ModuleInstance>> instantiate_module(JS
                         // 3.4.3.1. Create a host function from v and functype, and let funcaddr be the result.
                         cache.add_imported_object(function);
                         Wasm::HostFunction host_function {
-                            [&](auto&, auto& arguments) -> Wasm::Result {
+                            [&, is_numeric = is_numeric_signature(type)](auto&, auto& arguments) -> Wasm::Result {
+                                if (is_numeric)
+                                    return call_numeric_host_function(vm, function, type, arguments);
+
                                 GC::RootVector<JS::Value> argument_values { vm.heap() };
                                 size_t index = 0;
                                 for (auto& entry : arguments) {
@@ -398,14 +485,36 @@ JS::NativeFunction* create_native_function(JS::VM& vm, Wasm::FunctionAddress add
     if (auto entry = cache.get_function_instance(address); entry.has_value())
         return *entry;
 
+    auto is_numeric = is_numeric_signature(*type);
+    auto frame_size = frame_size_for_function(cache.abstract_machine().store(), address, *type);
+
     auto function = ExportedWasmFunction::create(
         realm,
         name,
-        [address, type = type.release_value(), instance](JS::VM& vm) -> JS::ThrowCompletionOr<JS::Value> {
+        [address, type = type.release_value(), instance, is_numeric, frame_size](JS::VM& vm) -> JS::ThrowCompletionOr<JS::Value> {
             (void)instance;
             auto& realm = *vm.current_realm();
             Vector<Wasm::Value> values;
-            values.ensure_capacity(type.parameters().size());
+            values.ensure_capacity(frame_size);
+
+            if (is_numeric) {
+                size_t index = 0;
+                for (auto& type : type.parameters())
+                    values.unchecked_append(TRY(to_numeric_webassembly_value(vm, vm.argument(index++), type)));
+
+                auto& cache = get_cache(realm);
+                auto result = cache.abstract_machine().invoke(address, move(values));
+                cache.did_finish_invocation();
+                // FIXME: Use the convoluted mapping of errors defined in the spec.
+                if (result.is_trap())
+                    return vm.throw_completion<JS::TypeError>(TRY_OR_THROW_OOM(vm, String::formatted("Wasm execution trapped (WIP): {}", result.trap().reason)));
+                if (result.is_completion())
+                    return result.completion();
+
+                if (result.values().is_empty())
+                    return JS::js_undefined();
+                return to_numeric_js_value(result.values().first(), type.results().first());
+            }
 
             // Grab as many values as needed and convert them.
             size_t index = 0;
@@ -414,6 +523,7 @@ JS::NativeFunction* create_native_function(JS::VM& vm, Wasm::FunctionAddress add
 
             auto& cache = get_cache(realm);
             auto result = cache.abstract_machine().invoke(address, move(values));
+            cache.did_finish_invocation();
             // FIXME: Use the convoluted mapping of errors defined in the spec.
             if (result.is_trap())
                 return vm.throw_completion<JS::TypeError>(TRY_OR_THROW_OOM(vm, String::formatted("Wasm execution trapped (WIP): {}", result.trap().reason)));
@@ -501,6 +611,32 @@ JS::ThrowCompletionOr<Wasm::Value> to_webassembly_value(JS::VM& vm, JS::Value va
     VERIFY_NOT_REACHED();
 }
 
+void start_profiling(JS::Realm& realm)
+{
+    get_cache(realm).set_profiler(make<Wasm::Profiler>());
+}
+
+String stop_profiling(JS::Realm& realm)
+{
+    auto& cache = get_cache(realm);
+    auto* profiler = cache.profiler();
+    if (!profiler)
+        return {};
+
+    auto name_of = [&](Wasm::FunctionAddress address) -> ByteString {
+        if (auto function = cache.get_function_instance(address); function.has_value() && *function)
+            return ByteString { (*function)->name().view() };
+        return Wasm::Profiler::default_function_name(cache.abstract_machine().store(), address);
+    };
+
+    AllocatingMemoryStream stream;
+    MUST(profiler->write_report(stream, name_of));
+    cache.set_profiler(nullptr);
+
+    auto buffer = MUST(stream.read_until_eof());
+    return MUST(String::from_utf8(StringView { buffer }));
+}
+
 Wasm::Value default_webassembly_value(JS::VM& vm, Wasm::ValueType type)
 {
     switch (type.kind()) {
@@ -14,6 +14,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWeb/Forward.h>
 
 namespace Web::WebAssembly {
@@ -57,6 +58,26 @@ public:
     HashTable<GC::Ptr<JS::Object>> imported_objects() const { return m_imported_objects; }
     Wasm::AbstractMachine& abstract_machine() { return m_abstract_machine; }
 
+    Wasm::Profiler* profiler() { return m_profiler.ptr(); }
+    void set_profiler(OwnPtr<Wasm::Profiler> profiler)
+    {
+        // NOTE: Invocations that are still on the stack (e.g. profiling was stopped from a JS import called by wasm)
+        //       keep using the profiler they started with, so it is only destroyed once the machine is idle.
+        if (m_profiler)
+            m_retired_profilers.append(m_profiler.release_nonnull());
+        m_profiler = move(profiler);
+        m_abstract_machine.set_profiler(m_profiler.ptr());
+        if (!m_abstract_machine.has_active_invocations())
+            m_retired_profilers.clear();
+    }
+
+    // Destroys the profilers that were replaced while wasm was running, once the outermost invocation has returned.
+    void did_finish_invocation()
+    {
+        if (!m_retired_profilers.is_empty() && !m_abstract_machine.has_active_invocations())
+            m_retired_profilers.clear();
+    }
+
 private:
     HashMap<Wasm::FunctionAddress, GC::Ptr<JS::NativeFunction>> m_function_instances;
     HashMap<Wasm::ExternAddress, JS::Value> m_extern_values;
@@ -64,6 +85,8 @@ private:
     Vector<NonnullRefPtr<CompiledWebAssemblyModule>> m_compiled_modules;
     HashTable<GC::Ptr<JS::Object>> m_imported_objects;
     Wasm::AbstractMachine m_abstract_machine;
+    OwnPtr<Wasm::Profiler> m_profiler;
+    Vector<NonnullOwnPtr<Wasm::Profiler>> m_retired_profilers;
 };
 
 class ExportedWasmFunction final : public JS::NativeFunction {
@@ -92,6 +115,9 @@ JS::ThrowCompletionOr<Wasm::Value> to_webassembly_value(JS::VM&, JS::Value value
 Wasm::Value default_webassembly_value(JS::VM&, Wasm::ValueType type);
 JS::Value to_js_value(JS::VM&, Wasm::Value& wasm_value, Wasm::ValueType type);
 
+void start_profiling(JS::Realm&);
+String stop_profiling(JS::Realm&);
+
 extern HashMap<GC::Ptr<JS::Object>, WebAssemblyCache> s_caches;
 
 }
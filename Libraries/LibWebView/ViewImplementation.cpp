@@ -702,6 +702,23 @@ ErrorOr<LexicalPath> ViewImplementation::dump_gc_graph()
     return path;
 }
 
+ErrorOr<LexicalPath> ViewImplementation::dump_rendering_trace(StringView file_name)
+{
+    auto promise = request_internal_page_info(PageInfoType::RenderingTrace);
+    auto rendering_trace_json = TRY(promise->await());
+
+    LexicalPath path { Core::StandardPaths::tempfile_directory() };
+    if (file_name.is_empty())
+        path = path.append(TRY(Core::DateTime::now().to_string("rendering-trace-%Y-%m-%d-%H-%M-%S.json"sv)));
+    else
+        path = path.append(file_name);
+
+    auto dump_file = TRY(Core::File::open(path.string(), Core::File::OpenMode::Write));
+    TRY(dump_file->write_until_depleted(rendering_trace_json.bytes()));
+
+    return path;
+}
+
 void ViewImplementation::set_user_style_sheet(String source)
 {
     client().async_set_user_style(page_id(), move(source));
@@ -43,6 +43,7 @@
 #include <LibWeb/Loader/ResourceLoader.h>
 #include <LibWeb/Loader/UserAgent.h>
 #include <LibWeb/Namespace.h>
+#include <LibWeb/Page/RenderingTrace.h>
 #include <LibWeb/Painting/StackingContext.h>
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
@@ -351,6 +352,21 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString const& request,
         return;
     }
 
+    if (request == "rendering-trace") {
+        if (argument == "reset") {
+            if (auto* rendering_trace = page->page().rendering_trace())
+                rendering_trace->reset();
+            return;
+        }
+        page->page().set_rendering_trace_enabled(argument == "on");
+        return;
+    }
+
+    if (request == "parallel-layout") {
+        page->page().set_parallel_layout_enabled(argument == "on");
+        return;
+    }
+
     if (request == "block-pop-ups") {
         page->page().set_should_block_pop_ups(argument == "on");
         return;
@@ -905,6 +921,17 @@ static void append_gc_graph(StringBuilder& builder)
     gc_graph.serialize(builder);
 }
 
+static void append_rendering_trace(Web::Page& page, StringBuilder& builder)
+{
+    auto* rendering_trace = page.rendering_trace();
+    if (!rendering_trace) {
+        builder.append("(rendering trace is disabled)"sv);
+        return;
+    }
+
+    builder.append(rendering_trace->to_chrome_trace_json());
+}
+
 void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::PageInfoType type)
 {
     auto page = this->page(page_id);
@@ -937,6 +964,12 @@ void ConnectionFromClient::request_internal_page_info(u64 page_id, WebView::Page
         append_gc_graph(builder);
     }
 
+    if (has_flag(type, WebView::PageInfoType::RenderingTrace)) {
+        if (!builder.is_empty())
+            builder.append("\n"sv);
+        append_rendering_trace(page->page(), builder);
+    }
+
     async_did_get_internal_page_info(page_id, type, MUST(builder.to_string()));
 }
 
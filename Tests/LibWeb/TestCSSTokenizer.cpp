@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/FlyString.h>
+#include <AK/StringBuilder.h>
+#include <LibTest/TestCase.h>
+#include <LibWeb/CSS/Parser/Tokenizer.h>
+
+namespace Web::CSS::Parser {
+
+static Vector<Token> tokenize(StringView input)
+{
+    return Tokenizer::tokenize(input, "utf-8"sv);
+}
+
+TEST_CASE(ident_with_non_ascii_code_points)
+{
+    auto tokens = tokenize("héllo-wörld_2 x"sv);
+    EXPECT_EQ(tokens.size(), 4u);
+    EXPECT(tokens[0].is(Token::Type::Ident));
+    EXPECT_EQ(tokens[0].ident(), "héllo-wörld_2"_fly_string);
+    EXPECT(tokens[1].is(Token::Type::Whitespace));
+    EXPECT_EQ(tokens[2].ident(), "x"_fly_string);
+    EXPECT(tokens[3].is(Token::Type::EndOfFile));
+}
+
+TEST_CASE(string_with_escapes)
+{
+    auto tokens = tokenize("\"ab\\41 cd\" 'it\"s'"sv);
+    EXPECT_EQ(tokens.size(), 4u);
+    EXPECT(tokens[0].is(Token::Type::String));
+    EXPECT_EQ(tokens[0].string(), "abAcd"_fly_string);
+    EXPECT_EQ(tokens[0].original_source_text(), "\"ab\\41 cd\""sv);
+    EXPECT(tokens[2].is(Token::Type::String));
+    EXPECT_EQ(tokens[2].string(), "it\"s"_fly_string);
+}
+
+TEST_CASE(bad_string)
+{
+    auto tokens = tokenize("\"abc\ndef"sv);
+    EXPECT_EQ(tokens.size(), 4u);
+    EXPECT(tokens[0].is(Token::Type::BadString));
+    EXPECT(tokens[1].is(Token::Type::Whitespace));
+    EXPECT_EQ(tokens[2].ident(), "def"_fly_string);
+}
+
+TEST_CASE(positions_after_comments_and_whitespace)
+{
+    auto tokens = tokenize("/* one\n * two */\n\tfoo\r\nbar"sv);
+    EXPECT_EQ(tokens.size(), 5u);
+    EXPECT(tokens[0].is(Token::Type::Whitespace));
+    EXPECT_EQ(tokens[1].ident(), "foo"_fly_string);
+    EXPECT_EQ(tokens[1].start_position().line, 2u);
+    EXPECT_EQ(tokens[1].start_position().column, 1u);
+    EXPECT(tokens[2].is(Token::Type::Whitespace));
+    EXPECT_EQ(tokens[3].ident(), "bar"_fly_string);
+    EXPECT_EQ(tokens[3].start_position().line, 3u);
+    EXPECT_EQ(tokens[3].start_position().column, 0u);
+}
+
+TEST_CASE(unterminated_comment)
+{
+    auto tokens = tokenize("a /* never closed"sv);
+    EXPECT_EQ(tokens.size(), 3u);
+    EXPECT_EQ(tokens[0].ident(), "a"_fly_string);
+    EXPECT(tokens[1].is(Token::Type::Whitespace));
+    EXPECT(tokens[2].is(Token::Type::EndOfFile));
+}
+
+// Roughly the shape of a utility-class CSS framework.
+static String make_framework_style_sheet()
+{
+    StringBuilder builder;
+    builder.append("/*! Example framework v1.0 | MIT License */\n"sv);
+    for (size_t i = 0; i < 2'000; ++i) {
+        builder.appendff(".container-{} > .row-{}:not(:last-child), .btn-outline-{}:hover {{\n", i, i, i);
+        builder.appendff("    --framework-gutter-x: {}rem;\n", i % 7);
+        builder.append("    font-family: system-ui, -apple-system, \"Segoe UI\", Roboto, \"Helvetica Neue\", sans-serif;\n"sv);
+        builder.appendff("    margin: calc(var(--framework-gutter-x) * -.5) {}px 0 auto !important;\n", i % 13);
+        builder.append("    background-image: url(\"data:image/svg+xml,%3csvg xmlns='http://www.w3.org/2000/svg'%3e%3c/svg%3e\");\n"sv);
+        builder.append("    /* Keep the transition short so hover feels snappy. */\n"sv);
+        builder.appendff("    transition: color .15s ease-in-out, box-shadow {}ms;\n", i);
+        builder.append("}\n"sv);
+    }
+    return builder.to_string_without_validation();
+}
+
+BENCHMARK_CASE(tokenize_framework_style_sheet)
+{
+    auto style_sheet = make_framework_style_sheet();
+    for (size_t i = 0; i < 20; ++i) {
+        auto tokens = tokenize(style_sheet);
+        EXPECT(tokens.last().is(Token::Type::EndOfFile));
+    }
+}
+
+}
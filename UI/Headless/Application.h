@@ -54,6 +54,8 @@ public:
     bool dump_layout_tree { false };
     bool dump_text { false };
     bool dump_gc_graph { false };
+    bool dump_rendering_trace { false };
+    bool enable_parallel_layout { false };
     bool is_layout_test_mode { false };
     size_t test_concurrency { 1 };
     ByteString python_executable_path;
@@ -157,6 +157,13 @@ void HeadlessWebView::initialize_client(CreateNewClient create_new_client)
     client().async_set_viewport_size(m_client_state.page_index, viewport_size());
     client().async_set_window_size(m_client_state.page_index, viewport_size());
     client().async_update_screen_rects(m_client_state.page_index, { screen_rect }, 0);
+
+    // NOTE: These are per-page settings, so they have to be sent again whenever WebContent is respawned after a crash.
+    auto const& app = Application::the();
+    if (app.dump_rendering_trace)
+        debug_request("rendering-trace", "on");
+    if (app.enable_parallel_layout)
+        debug_request("parallel-layout", "on");
 }
 
 void HeadlessWebView::clear_content_filters()
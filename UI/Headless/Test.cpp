@@ -278,6 +278,25 @@ void run_dump_test(HeadlessWebView& view, Test& test, URL::URL const& url, int t
     timer->start();
 }
 
+// Dumps the frames rendered while running the test, then starts over, so that each test gets a trace of its own.
+void dump_rendering_trace(HeadlessWebView& view, Test const& test, TestResult result)
+{
+    // NOTE: WebContent may still be busy with a test that timed out, and a crashed WebContent took its trace with it,
+    //       so waiting for the trace of either could block the test run.
+    if (result != TestResult::Timeout && result != TestResult::Crashed) {
+        ByteString file_name;
+        if (!test.relative_path.is_empty())
+            file_name = ByteString::formatted("rendering-trace-{}.json", test.relative_path.replace("/"sv, "-"sv, ReplaceMode::All));
+
+        if (auto path = view.dump_rendering_trace(file_name); path.is_error())
+            warnln("Failed to dump rendering trace: {}", path.error());
+        else
+            outln("Rendering trace dumped to {}", path.value());
+    }
+
+    view.debug_request("rendering-trace", "reset");
+}
+
 static void run_ref_test(HeadlessWebView& view, Test& test, URL::URL const& url, int timeout_in_milliseconds)
 {
     auto timer = Core::Timer::create_single_shot(timeout_in_milliseconds, [&view, &test]() {
@@ -597,6 +616,9 @@ ErrorOr<void> run_tests(Core::AnonymousBuffer const& theme, Web::DevicePixelSize
                 break;
             }
 
+            if (app.dump_rendering_trace)
+                dump_rendering_trace(view, result.test, result.result);
+
             if (result.result != TestResult::Pass)
                 non_passing_tests.append(move(result));
 
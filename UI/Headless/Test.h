@@ -90,5 +90,6 @@ using TestPromise = Core::Promise<TestCompletion>;
 
 ErrorOr<void> run_tests(Core::AnonymousBuffer const& theme, Web::DevicePixelSize window_size);
 void run_dump_test(HeadlessWebView&, Test&, URL::URL const&, int timeout_in_milliseconds);
+void dump_rendering_trace(HeadlessWebView&, Test const&, TestResult);
 
 }
@@ -95,6 +95,10 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         Ladybird::run_dump_test(view, test, url, app->per_test_timeout_in_seconds * 1000);
 
         auto completion = MUST(view.test_promise().await());
+
+        if (app->dump_rendering_trace)
+            Ladybird::dump_rendering_trace(view, test, completion.result);
+
         return completion.result == Ladybird::TestResult::Pass ? 0 : 1;
     }
 
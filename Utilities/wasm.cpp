@@ -17,6 +17,7 @@
 #include <LibMain/Main.h>
 #include <LibWasm/AbstractMachine/AbstractMachine.h>
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
+#include <LibWasm/AbstractMachine/Profiler.h>
 #include <LibWasm/Printer/Printer.h>
 #include <LibWasm/Types.h>
 #include <LibWasm/Wasi.h>
@@ -523,6 +524,8 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     bool export_all_imports = false;
     bool shell_mode = false;
     bool wasi = false;
+    bool profile = false;
+    StringView folded_stacks_path;
     ByteString exported_function_to_execute;
     Vector<ParsedValue> values_to_push;
     Vector<ByteString> modules_to_link_in;
@@ -538,6 +541,8 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     parser.add_option(export_all_imports, "Export noop functions corresponding to imports", "export-noop");
     parser.add_option(shell_mode, "Launch a REPL in the module's context (implies -i)", "shell", 's');
     parser.add_option(wasi, "Enable WASI", "wasi", 'w');
+    parser.add_option(profile, "Profile the execution and print a report to stderr", "profile");
+    parser.add_option(folded_stacks_path, "Profile the execution and write folded stacks to the given file", "profile-folded", 0, "path");
     parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Required,
         .help_string = "Directory mappings to expose via WASI",
@@ -599,6 +604,9 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
         old_signal = signal(SIGINT, sigint_handler);
     }
 
+    if (!folded_stacks_path.is_empty())
+        profile = true;
+
     if (!exported_function_to_execute.is_empty())
         attempt_instantiate = true;
 
@@ -617,6 +625,9 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
     if (attempt_instantiate) {
         Wasm::AbstractMachine machine;
         Optional<Wasm::Wasi::Implementation> wasi_impl;
+        Wasm::Profiler profiler;
+        if (profile)
+            machine.set_profiler(&profiler);
 
         if (wasi) {
             wasi_impl.emplace(Wasm::Wasi::Implementation::Details {
@@ -835,6 +846,33 @@ ErrorOr<int> serenity_main(Main::Arguments arguments)
 
             auto result = machine.invoke(g_interpreter, run_address.value(), move(values)).assert_wasm_result();
 
+            if (profile) {
+                HashMap<Wasm::FunctionAddress, ByteString> exported_names;
+                auto collect_exported_names = [&](Wasm::ModuleInstance const& instance) {
+                    for (auto& entry : instance.exports()) {
+                        if (auto address = entry.value().get_pointer<Wasm::FunctionAddress>())
+                            exported_names.set(*address, entry.name());
+                    }
+                };
+                for (auto& instance : linked_instances)
+                    collect_exported_names(*instance);
+                collect_exported_names(*module_instance);
+
+                auto name_of = [&](Wasm::FunctionAddress address) -> ByteString {
+                    if (auto name = exported_names.get(address); name.has_value())
+                        return *name;
+                    return Wasm::Profiler::default_function_name(machine.store(), address);
+                };
+
+                auto standard_error = TRY(Core::File::standard_error());
+                TRY(profiler.write_report(*standard_error, name_of));
+
+                if (!folded_stacks_path.is_empty()) {
+                    auto file = TRY(Core::File::open(folded_stacks_path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+                    TRY(profiler.write_folded_stacks(*file, name_of));
+                }
+            }
+
             if (debug)
                 launch_repl();
 